@@ -19,8 +19,103 @@ std::optional<Config> Config::loadFromFile(std::string_view path)
         }
         config.port = static_cast<uint16_t>(*port);
 
+        // Negative sizes and durations would wrap around to huge values, so they are rejected
+        const auto readSize = [&](const char* key, int64_t defaultValue, size_t& dest) {
+            const auto value = table[key].value_or<int64_t>(defaultValue);
+            if (value < 0) {
+                spdlog::error("'{}' must not be negative.", key);
+                return false;
+            }
+            dest = static_cast<size_t>(value);
+            return true;
+        };
+
         const auto defaultThreads = std::thread::hardware_concurrency();
-        config.numThreads = table["numThreads"].value_or<int64_t>(defaultThreads);
+        if (!readSize("numThreads", defaultThreads, config.numThreads))
+            return std::nullopt;
+        config.pinThreads = table["pinThreads"].value_or(false);
+
+        config.ioBackend = table["ioBackend"].value<std::string>();
+        if (config.ioBackend && *config.ioBackend != "epoll" && *config.ioBackend != "io_uring") {
+            spdlog::error("'ioBackend' must be 'epoll' or 'io_uring'.");
+            return std::nullopt;
+        }
+
+        if (!readSize("statsInterval", 60, config.statsInterval))
+            return std::nullopt;
+
+        const auto recvBufferPolicy = table["recvBufferPolicy"].value_or<std::string>("adaptive");
+        if (recvBufferPolicy == "fixed") {
+            config.recvBufferPolicy = RecvBufferPolicy::fixed;
+        } else if (recvBufferPolicy == "adaptive") {
+            config.recvBufferPolicy = RecvBufferPolicy::adaptive;
+        } else {
+            spdlog::error("'recvBufferPolicy' must be 'fixed' or 'adaptive'.");
+            return std::nullopt;
+        }
+        if (!readSize("recvBufferMinSize", 512, config.recvBufferMinSize)
+            || !readSize("recvBufferMaxSize", 64 * 1024, config.recvBufferMaxSize)
+            || !readSize("recvBufferShrinkDelay", 5000, config.recvBufferShrinkDelay))
+            return std::nullopt;
+        if (config.recvBufferMinSize == 0 || config.recvBufferMaxSize < config.recvBufferMinSize) {
+            spdlog::error("'recvBufferMinSize' must be > 0 and <= 'recvBufferMaxSize'.");
+            return std::nullopt;
+        }
+
+        if (!readSize("maxFrameSize", 128 * 1024, config.maxFrameSize)
+            || !readSize("maxInboundBytes", 256 * 1024 * 1024, config.maxInboundBytes))
+            return std::nullopt;
+        // Every message has at least a type
+        if (config.maxFrameSize < sizeof(uint32_t) + 1) {
+            spdlog::error("'maxFrameSize' must be at least 5.");
+            return std::nullopt;
+        }
+        const auto oversizedFramePolicy
+            = table["oversizedFramePolicy"].value_or<std::string>("close");
+        if (oversizedFramePolicy == "discard") {
+            config.oversizedFramePolicy = OversizedFramePolicy::discard;
+        } else if (oversizedFramePolicy == "close") {
+            config.oversizedFramePolicy = OversizedFramePolicy::close;
+        } else {
+            spdlog::error("'oversizedFramePolicy' must be 'discard' or 'close'.");
+            return std::nullopt;
+        }
+
+        if (!readSize("maxWriteBytes", 64 * 1024, config.maxWriteBytes)
+            || !readSize("maxWriteBuffers", 64, config.maxWriteBuffers))
+            return std::nullopt;
+        // Linux does not allow more than 1024 (IOV_MAX) buffers for writev
+        if (config.maxWriteBuffers < 1 || config.maxWriteBuffers > 1024) {
+            spdlog::error("'maxWriteBuffers' must be in [1, 1024].");
+            return std::nullopt;
+        }
+
+        if (!readSize("maxSendQueueBytes", 1024 * 1024, config.maxSendQueueBytes)
+            || !readSize("maxSendQueueMessages", 4096, config.maxSendQueueMessages))
+            return std::nullopt;
+        const auto slowConsumerPolicy
+            = table["slowConsumerPolicy"].value_or<std::string>("disconnect");
+        if (slowConsumerPolicy == "dropOldest") {
+            config.slowConsumerPolicy = SlowConsumerPolicy::dropOldest;
+        } else if (slowConsumerPolicy == "dropNew") {
+            config.slowConsumerPolicy = SlowConsumerPolicy::dropNew;
+        } else if (slowConsumerPolicy == "disconnect") {
+            config.slowConsumerPolicy = SlowConsumerPolicy::disconnect;
+        } else {
+            spdlog::error("'slowConsumerPolicy' must be 'dropOldest', 'dropNew' or 'disconnect'.");
+            return std::nullopt;
+        }
+
+        // Clients are not required to send heartbeats (yet), so idle connections are kept by
+        // default (see Config::heartbeatTimeout)
+        if (!readSize("heartbeatTimeout", 0, config.heartbeatTimeout)
+            || !readSize("frameTimeout", 10000, config.frameTimeout)
+            || !readSize("timeoutResolution", 1000, config.timeoutResolution))
+            return std::nullopt;
+        if (config.timeoutResolution == 0) {
+            spdlog::error("'timeoutResolution' must be > 0.");
+            return std::nullopt;
+        }
 
         return config;
     } catch (const toml::parse_error& err) {
@@ -1,11 +1,48 @@
 #pragma once
 
 #include <optional>
+#include <string>
 #include <string_view>
 
 struct Config {
+    enum class RecvBufferPolicy {
+        fixed, // always read into recvBufferMinSize bytes and keep the buffer
+        adaptive, // grow with frame sizes, shrink after recvBufferShrinkDelay, release when idle
+    };
+
+    enum class OversizedFramePolicy {
+        discard, // skip the frame without buffering it
+        close, // close the connection
+    };
+
+    enum class SlowConsumerPolicy {
+        dropOldest, // drop queued messages that are not being written yet
+        dropNew, // drop the message that does not fit anymore
+        disconnect,
+    };
+
     uint16_t port;
     size_t numThreads;
+    bool pinThreads; // pin each worker thread to a core
+    std::optional<std::string> ioBackend; // must match the backend the server was built with
+    size_t statsInterval; // seconds, 0 disables stats logging
+    RecvBufferPolicy recvBufferPolicy;
+    size_t recvBufferMinSize;
+    size_t recvBufferMaxSize;
+    size_t recvBufferShrinkDelay; // milliseconds
+    size_t maxFrameSize; // including the length prefix
+    size_t maxInboundBytes; // pending bytes of all connections, 0 is unlimited
+    OversizedFramePolicy oversizedFramePolicy;
+    size_t maxWriteBytes; // per gather write, a single bigger message is still written at once
+    size_t maxWriteBuffers; // per gather write
+    size_t maxSendQueueBytes; // per connection
+    size_t maxSendQueueMessages; // per connection
+    SlowConsumerPolicy slowConsumerPolicy; // what to do if a send queue is full
+    // Milliseconds without any received bytes, 0 disables it. It defaults to 0, because clients
+    // don't send heartbeats yet, so idle connections are NOT closed unless this is configured.
+    size_t heartbeatTimeout;
+    size_t frameTimeout; // milliseconds to receive a started frame completely, 0 disables it
+    size_t timeoutResolution; // milliseconds, how often timeouts are checked
 
     static std::optional<Config> loadFromFile(std::string_view path);
 };
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "Stats.hpp"
+
+// Memory for asio completion handlers that is reused instead of being allocated for every
+// operation (see asio's "allocation" example). Any thread may allocate from it. If the handler
+// is too big or all slots are in use, we fall back to the heap.
+template <size_t SlotSize, size_t NumSlots>
+class HandlerMemory {
+public:
+    HandlerMemory() = default;
+    HandlerMemory(const HandlerMemory&) = delete;
+    HandlerMemory& operator=(const HandlerMemory&) = delete;
+
+    void* allocate(size_t size)
+    {
+        if (size <= SlotSize) {
+            for (size_t i = 0; i < NumSlots; ++i) {
+                // Check first, so we don't bounce the cache line between threads needlessly
+                if (!inUse_[i].load(std::memory_order_relaxed)
+                    && !inUse_[i].exchange(true, std::memory_order_acquire))
+                    return &slots_[i];
+            }
+        }
+        stats.handlerHeapAllocations.add();
+        return ::operator new(size);
+    }
+
+    void deallocate(void* ptr)
+    {
+        for (size_t i = 0; i < NumSlots; ++i) {
+            if (ptr == &slots_[i]) {
+                inUse_[i].store(false, std::memory_order_release);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    struct alignas(std::max_align_t) Slot {
+        std::byte data[SlotSize];
+    };
+
+    std::array<Slot, NumSlots> slots_;
+    std::array<std::atomic<bool>, NumSlots> inUse_ {};
+};
+
+template <typename T, typename Memory>
+class HandlerAllocator {
+public:
+    using value_type = T;
+
+    explicit HandlerAllocator(Memory& memory)
+        : memory_(&memory)
+    {
+    }
+
+    template <typename U>
+    HandlerAllocator(const HandlerAllocator<U, Memory>& other) noexcept
+        : memory_(other.memory_)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(memory_->allocate(sizeof(T) * n));
+    }
+
+    void deallocate(T* ptr, size_t /*n*/)
+    {
+        memory_->deallocate(ptr);
+    }
+
+    bool operator==(const HandlerAllocator& other) const noexcept
+    {
+        return memory_ == other.memory_;
+    }
+
+    bool operator!=(const HandlerAllocator& other) const noexcept
+    {
+        return memory_ != other.memory_;
+    }
+
+private:
+    template <typename, typename>
+    friend class HandlerAllocator;
+
+    Memory* memory_;
+};
+
+// Wraps a handler, so asio picks up HandlerAllocator through associated_allocator
+template <typename Handler, typename Memory>
+class AllocHandler {
+public:
+    using allocator_type = HandlerAllocator<Handler, Memory>;
+
+    AllocHandler(Memory& memory, Handler handler)
+        : memory_(memory)
+        , handler_(std::move(handler))
+    {
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(memory_);
+    }
+
+    template <typename... Args>
+    void operator()(Args&&... args)
+    {
+        handler_(std::forward<Args>(args)...);
+    }
+
+private:
+    Memory& memory_;
+    Handler handler_;
+};
+
+template <typename Memory, typename Handler>
+AllocHandler<std::decay_t<Handler>, Memory> makeAllocHandler(Memory& memory, Handler&& handler)
+{
+    return AllocHandler<std::decay_t<Handler>, Memory>(memory, std::forward<Handler>(handler));
+}
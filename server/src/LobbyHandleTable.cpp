@@ -0,0 +1,99 @@
+#include "LobbyHandleTable.hpp"
+
+#include "util.hpp"
+
+class LobbyHandleTable::SlotLock {
+public:
+    SlotLock(const Slot& slot)
+        : locked_(slot.locked)
+    {
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) { }
+        }
+    }
+
+    ~SlotLock()
+    {
+        locked_.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool>& locked_;
+};
+
+LobbyHandleTable::~LobbyHandleTable()
+{
+    for (auto& chunk : chunks_)
+        delete chunk.load(std::memory_order_relaxed);
+}
+
+LobbyHandleTable::Handle LobbyHandleTable::acquire(LobbyNameAllocator::Index nameIndex)
+{
+    auto& slot = getSlot(nameIndex);
+    SlotLock lock(slot);
+    auto generation = slot.generation.load(std::memory_order_relaxed);
+    generation = generation < maxGeneration ? generation + 1 : 1;
+    slot.generation.store(generation, std::memory_order_relaxed);
+    return (generation << indexBits) | nameIndex;
+}
+
+void LobbyHandleTable::set(Handle handle, std::weak_ptr<Lobby> lobby)
+{
+    auto& slot = getSlot(handle & indexMask);
+    SlotLock lock(slot);
+    if (slot.generation.load(std::memory_order_relaxed) == handle >> indexBits)
+        slot.lobby = std::move(lobby);
+}
+
+void LobbyHandleTable::clear(Handle handle)
+{
+    auto& slot = getSlot(handle & indexMask);
+    SlotLock lock(slot);
+    if (slot.generation.load(std::memory_order_relaxed) == handle >> indexBits)
+        slot.lobby.reset();
+}
+
+std::shared_ptr<Lobby> LobbyHandleTable::find(Handle handle) const
+{
+    const auto slot = findSlot(handle & indexMask);
+    if (!slot || slot->generation.load(std::memory_order_relaxed) != handle >> indexBits)
+        return nullptr;
+    std::weak_ptr<Lobby> lobby;
+    {
+        // Checked again, the slot may have been reused in the meantime
+        SlotLock lock(*slot);
+        if (slot->generation.load(std::memory_order_relaxed) != handle >> indexBits)
+            return nullptr;
+        lobby = slot->lobby;
+    }
+    return lobby.lock();
+}
+
+LobbyHandleTable::Slot& LobbyHandleTable::getSlot(LobbyNameAllocator::Index index)
+{
+    auto& chunk = chunks_[index / chunkSize];
+    auto ptr = chunk.load(std::memory_order_acquire);
+    if (!ptr) {
+        std::lock_guard lock(chunkMutex_);
+        ptr = chunk.load(std::memory_order_acquire);
+        if (!ptr) {
+            ptr = new Chunk();
+            for (auto& slot : *ptr) {
+                slot.generation.store(
+                    randInt<Handle>(1, maxGeneration), std::memory_order_relaxed);
+            }
+            chunk.store(ptr, std::memory_order_release);
+        }
+    }
+    return (*ptr)[index % chunkSize];
+}
+
+const LobbyHandleTable::Slot* LobbyHandleTable::findSlot(LobbyNameAllocator::Index index) const
+{
+    if (index >= LobbyNameAllocator::numNames)
+        return nullptr;
+    const auto chunk = chunks_[index / chunkSize].load(std::memory_order_acquire);
+    if (!chunk)
+        return nullptr;
+    return &(*chunk)[index % chunkSize];
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "LobbyNameAllocator.hpp"
+
+struct Lobby;
+
+// Resolves the numeric lobby handles that clients receive with lobbyJoined, so they can join
+// without sending the name.
+// A handle consists of the index of the lobby's name (which belongs to at most one live lobby)
+// and a generation that is incremented whenever the name is given to a new lobby, so a stale
+// handle does not resolve to the next lobby with that name. Every slot starts at a random
+// generation, so handles cannot be enumerated by walking the indices. Generation 0 is never used.
+// Slots are allocated in chunks when they are first used, so a lookup is a bounds check and a load
+// of the chunk and never takes a lock on the whole table.
+class LobbyHandleTable {
+public:
+    using Handle = uint32_t;
+
+    LobbyHandleTable() = default;
+    ~LobbyHandleTable();
+
+    LobbyHandleTable(const LobbyHandleTable&) = delete;
+    LobbyHandleTable& operator=(const LobbyHandleTable&) = delete;
+
+    // Returns the handle for a new lobby with this name
+    Handle acquire(LobbyNameAllocator::Index nameIndex);
+
+    // The lobby can be found by its handle from now on
+    void set(Handle handle, std::weak_ptr<Lobby> lobby);
+
+    // Called by dying lobbies
+    void clear(Handle handle);
+
+    // Returns nullptr if the handle is invalid or its lobby is gone
+    std::shared_ptr<Lobby> find(Handle handle) const;
+
+private:
+    static constexpr size_t indexBits = 21;
+    static constexpr Handle indexMask = (Handle(1) << indexBits) - 1;
+    static constexpr Handle maxGeneration = ~Handle(0) >> indexBits;
+    static constexpr size_t chunkSize = 4096;
+    static constexpr size_t numChunks
+        = (LobbyNameAllocator::numNames + chunkSize - 1) / chunkSize;
+
+    static_assert(LobbyNameAllocator::numNames <= indexMask + 1);
+
+    struct Slot {
+        // Protects lobby. It is only held to copy the weak_ptr, so we just spin.
+        mutable std::atomic<bool> locked { false };
+        // Only written with locked held, but lookups compare it before taking the lock, so
+        // invalid handles never touch the lock.
+        std::atomic<Handle> generation { 0 };
+        std::weak_ptr<Lobby> lobby;
+    };
+
+    using Chunk = std::array<Slot, chunkSize>;
+
+    class SlotLock;
+
+    // Allocates the chunk of the slot, if necessary
+    Slot& getSlot(LobbyNameAllocator::Index index);
+
+    // Returns nullptr if the chunk of the slot has not been allocated yet
+    const Slot* findSlot(LobbyNameAllocator::Index index) const;
+
+    std::mutex chunkMutex_; // only taken to allocate a chunk
+    std::array<std::atomic<Chunk*>, numChunks> chunks_ {};
+};
@@ -0,0 +1,33 @@
+#include "LobbyMessages.hpp"
+
+std::ostream& operator<<(std::ostream& os, MessageType type)
+{
+    switch (type) {
+    case MessageType::createLobby:
+        return os << "createLobby";
+    case MessageType::joinLobby:
+        return os << "joinLobby";
+    case MessageType::lobbyJoined:
+        return os << "lobbyJoined";
+    case MessageType::leaveLobby:
+        return os << "leaveLobby";
+    case MessageType::lockLobby:
+        return os << "lockLobby";
+    case MessageType::unlockLobby:
+        return os << "unlockLobby";
+    case MessageType::sendMessage:
+        return os << "sendMessage";
+    case MessageType::relayMessage:
+        return os << "relayMessage";
+    case MessageType::requestLobbyUpdate:
+        return os << "requestLobbyUpdate";
+    case MessageType::updateLobby:
+        return os << "updateLobby";
+    case MessageType::heartbeat:
+        return os << "heartbeat";
+    case MessageType::joinLobbyByHandle:
+        return os << "joinLobbyByHandle";
+    default:
+        return os << "Unknown";
+    }
+}
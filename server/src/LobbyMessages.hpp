@@ -0,0 +1,173 @@
+#pragma once
+
+#include <ostream>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
+
+#include "MessageSchema.hpp"
+
+enum class MessageType : uint8_t {
+    createLobby = 0, // c -> s
+    joinLobby = 2, // c -> s
+    lobbyJoined = 3, // c <- s
+    leaveLobby = 4, // c -> s
+    lockLobby = 5, // c -> s
+    unlockLobby = 6, // c -> s
+    sendMessage = 7, // c -> s
+    relayMessage = 8, // c <- s
+    requestLobbyUpdate = 9, // c -> s
+    updateLobby = 10, // c <- s
+    heartbeat = 11, // c -> s
+    joinLobbyByHandle = 12, // c -> s
+    lastMessageType,
+};
+
+std::ostream& operator<<(std::ostream& os, MessageType type);
+
+// c -> s
+
+struct CreateLobbyMessage {
+    static constexpr auto type = MessageType::createLobby;
+
+    std::string_view playerName;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(stringField(&CreateLobbyMessage::playerName));
+    }
+};
+
+struct JoinLobbyMessage {
+    static constexpr auto type = MessageType::joinLobby;
+
+    std::string_view playerName;
+    std::string_view lobbyName;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(stringField(&JoinLobbyMessage::playerName),
+            stringField(&JoinLobbyMessage::lobbyName));
+    }
+};
+
+struct LeaveLobbyMessage {
+    static constexpr auto type = MessageType::leaveLobby;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple();
+    }
+};
+
+struct LockLobbyMessage {
+    static constexpr auto type = MessageType::lockLobby;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple();
+    }
+};
+
+struct UnlockLobbyMessage {
+    static constexpr auto type = MessageType::unlockLobby;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple();
+    }
+};
+
+struct SendMessageMessage {
+    static constexpr auto type = MessageType::sendMessage;
+
+    std::string_view message;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(stringField<uint16_t>(&SendMessageMessage::message));
+    }
+};
+
+struct RequestLobbyUpdateMessage {
+    static constexpr auto type = MessageType::requestLobbyUpdate;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple();
+    }
+};
+
+struct HeartbeatMessage {
+    static constexpr auto type = MessageType::heartbeat;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple();
+    }
+};
+
+struct JoinLobbyByHandleMessage {
+    static constexpr auto type = MessageType::joinLobbyByHandle;
+
+    std::string_view playerName;
+    uint32_t handle;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(stringField(&JoinLobbyByHandleMessage::playerName),
+            integerField(&JoinLobbyByHandleMessage::handle));
+    }
+};
+
+// c <- s
+
+struct LobbyJoinedMessage {
+    static constexpr auto type = MessageType::lobbyJoined;
+
+    std::string_view lobbyName;
+    uint8_t playerId;
+    uint32_t handle; // appended, so clients that don't know about handles can ignore it
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(stringField(&LobbyJoinedMessage::lobbyName),
+            integerField(&LobbyJoinedMessage::playerId), integerField(&LobbyJoinedMessage::handle));
+    }
+};
+
+// Only the header of relayMessage is encoded, the message itself follows as a separate buffer
+struct RelayMessageHeader {
+    static constexpr auto type = MessageType::relayMessage;
+
+    uint8_t playerId;
+    uint16_t messageSize;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(integerField(&RelayMessageHeader::playerId),
+            integerField(&RelayMessageHeader::messageSize));
+    }
+};
+
+struct UpdateLobbyMessage {
+    static constexpr auto type = MessageType::updateLobby;
+
+    struct Player {
+        uint8_t id;
+        std::string_view name;
+
+        static constexpr auto fields()
+        {
+            return std::make_tuple(integerField(&Player::id), stringField(&Player::name));
+        }
+    };
+
+    // Big enough for typical lobbies, so encoding an update does not allocate for them
+    boost::container::small_vector<Player, 32> players;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(listField(&UpdateLobbyMessage::players));
+    }
+};
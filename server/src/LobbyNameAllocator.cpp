@@ -0,0 +1,64 @@
+#include "LobbyNameAllocator.hpp"
+
+#include <cassert>
+#include <limits>
+#include <utility>
+
+#include "util.hpp"
+
+static_assert(
+    LobbyNameAllocator::numNames <= std::numeric_limits<LobbyNameAllocator::Index>::max());
+
+LobbyNameAllocator::LobbyNameAllocator()
+{
+    for (auto& key : roundKeys_)
+        key = randInt<uint64_t>(0, std::numeric_limits<uint64_t>::max());
+}
+
+std::optional<LobbyNameAllocator::Index> LobbyNameAllocator::allocate()
+{
+    std::lock_guard lock(mutex_);
+    if (numShuffled_ < numNames) {
+        // Less than three rounds on average, since the domain is less than three times numNames
+        auto index = permute(numShuffled_);
+        while (index >= numNames)
+            index = permute(index);
+        numShuffled_++;
+        return static_cast<Index>(index);
+    }
+    if (released_.empty())
+        return std::nullopt;
+    const auto index = released_.front();
+    released_.pop_front();
+    return index;
+}
+
+void LobbyNameAllocator::release(Index index)
+{
+    assert(index < numNames);
+    std::lock_guard lock(mutex_);
+    released_.push_back(index);
+}
+
+uint64_t LobbyNameAllocator::permute(uint64_t value) const
+{
+    auto left = value >> halfBits;
+    auto right = value & halfMask;
+    for (const auto key : roundKeys_) {
+        // The round function takes the top bits of a multiplicative hash of the keyed half
+        const auto f = ((right ^ key) * 0x9e3779b97f4a7c15) >> (64 - halfBits);
+        left = std::exchange(right, left ^ f);
+    }
+    return (left << halfBits) | right;
+}
+
+std::string LobbyNameAllocator::getName(Index index)
+{
+    const auto& adjective = adjectives[index / std::size(nouns)];
+    const auto& noun = nouns[index % std::size(nouns)];
+    std::string name;
+    name.reserve(adjective.size() + noun.size());
+    name.append(adjective);
+    name.append(noun);
+    return name;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "words.hpp"
+
+template <size_t N>
+constexpr size_t getMaxLength(const std::string_view (&words)[N])
+{
+    size_t maxLength = 0;
+    for (const auto& word : words)
+        maxLength = std::max(maxLength, word.size());
+    return maxLength;
+}
+
+// Hands out lobby names (adjective + noun), so that no two live lobbies have the same name.
+// A name is identified by its index in the space of all adjective/noun combinations. Unused names
+// are walked in a shuffled order and released names are reused after that, so both allocating and
+// releasing a name take constant time, no matter how many are in use.
+// The order is a keyed Feistel network over the smallest power of two domain that has room for
+// all names. Values outside of the names are mapped again until they land on one (cycle-walking),
+// which is still a permutation. With random round keys, the next name can't be predicted from the
+// ones that were handed out before.
+class LobbyNameAllocator {
+public:
+    using Index = uint32_t;
+
+    static constexpr size_t numNames = std::size(adjectives) * std::size(nouns);
+    static constexpr size_t maxNameLength = getMaxLength(adjectives) + getMaxLength(nouns);
+
+    LobbyNameAllocator();
+
+    // Returns nullopt if all names are in use
+    std::optional<Index> allocate();
+
+    void release(Index index);
+
+    static std::string getName(Index index);
+
+private:
+    static constexpr size_t halfBits = 11;
+    static constexpr uint64_t halfMask = (uint64_t(1) << halfBits) - 1;
+    static constexpr size_t numRounds = 4;
+
+    static_assert(numNames <= uint64_t(1) << (2 * halfBits));
+
+    // A permutation of [0, 2^(2 * halfBits))
+    uint64_t permute(uint64_t value) const;
+
+    std::mutex mutex_;
+    std::array<uint64_t, numRounds> roundKeys_;
+    uint64_t numShuffled_ = 0; // the number of names that were taken from the permutation
+    std::deque<Index> released_; // oldest first, so a name is not reused right away
+};
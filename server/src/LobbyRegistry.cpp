@@ -0,0 +1,68 @@
+#include "LobbyRegistry.hpp"
+
+size_t LobbyKey::Hash::operator()(const LobbyKey& key) const
+{
+    return std::hash<std::string_view>()(key.view());
+}
+
+std::optional<LobbyKey> LobbyKey::fromName(std::string_view name)
+{
+    if (name.size() > maxSize)
+        return std::nullopt;
+    LobbyKey key;
+    // Lobby names are ASCII, so we don't need the locale
+    for (size_t i = 0; i < name.size(); ++i) {
+        const auto c = name[i];
+        key.chars_[i] = c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    key.size_ = static_cast<uint8_t>(name.size());
+    return key;
+}
+
+std::string_view LobbyKey::view() const
+{
+    return std::string_view(chars_.data(), size_);
+}
+
+bool LobbyKey::operator==(const LobbyKey& other) const
+{
+    return view() == other.view();
+}
+
+std::shared_ptr<Lobby> LobbyRegistry::find(std::string_view name) const
+{
+    const auto key = LobbyKey::fromName(name);
+    if (!key)
+        return nullptr;
+    const auto& shard = getShard(*key);
+    std::shared_lock lock(shard.mutex);
+    const auto it = shard.lobbies.find(*key);
+    if (it != shard.lobbies.end())
+        return it->second.lock();
+    else
+        return nullptr;
+}
+
+void LobbyRegistry::eraseExpired(std::string_view name)
+{
+    const auto key = LobbyKey::fromName(name);
+    if (!key)
+        return;
+    auto& shard = getShard(*key);
+    std::unique_lock lock(shard.mutex);
+    const auto it = shard.lobbies.find(*key);
+    if (it != shard.lobbies.end() && it->second.expired()) {
+        shard.lobbies.erase(it);
+        stats.registryEntries.sub();
+    }
+}
+
+LobbyRegistry::Shard& LobbyRegistry::getShard(const LobbyKey& key)
+{
+    return shards_[LobbyKey::Hash()(key) % numShards];
+}
+
+const LobbyRegistry::Shard& LobbyRegistry::getShard(const LobbyKey& key) const
+{
+    return shards_[LobbyKey::Hash()(key) % numShards];
+}
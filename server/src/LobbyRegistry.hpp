@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "LobbyNameAllocator.hpp"
+#include "Stats.hpp"
+
+struct Lobby;
+
+// A lobby name in lower case. It is stored inline, so building one for a lookup does not allocate.
+class LobbyKey {
+public:
+    static constexpr size_t maxSize = LobbyNameAllocator::maxNameLength;
+    static_assert(maxSize <= std::numeric_limits<uint8_t>::max()); // see size_
+
+    struct Hash {
+        size_t operator()(const LobbyKey& key) const;
+    };
+
+    // Returns nullopt if name is too long to be the name of any lobby
+    static std::optional<LobbyKey> fromName(std::string_view name);
+
+    std::string_view view() const;
+
+    bool operator==(const LobbyKey& other) const;
+
+private:
+    LobbyKey() = default;
+
+    std::array<char, maxSize> chars_;
+    uint8_t size_ = 0;
+};
+
+// Maps lobby names (ignoring case) to lobbies. The map is split into shards with a lock each, so
+// lookups never take a global lock and creates only contend with others in the same shard.
+class LobbyRegistry {
+public:
+    std::shared_ptr<Lobby> find(std::string_view name) const;
+
+    // Calls makeLobby and inserts the result, if name is not taken by a live lobby.
+    // Returns nullptr otherwise.
+    template <typename Factory>
+    std::shared_ptr<Lobby> insertIfAbsent(std::string_view name, Factory&& makeLobby)
+    {
+        const auto key = LobbyKey::fromName(name);
+        if (!key)
+            return nullptr;
+        auto& shard = getShard(*key);
+        std::unique_lock lock(shard.mutex);
+        const auto it = shard.lobbies.find(*key);
+        if (it != shard.lobbies.end() && !it->second.expired())
+            return nullptr;
+        std::shared_ptr<Lobby> lobby = makeLobby();
+        if (it != shard.lobbies.end()) {
+            // The old lobby is dying, but has not removed itself yet
+            it->second = lobby;
+        } else {
+            shard.lobbies.emplace(*key, lobby);
+            stats.registryEntries.add();
+        }
+        return lobby;
+    }
+
+    // Called by dying lobbies. The entry is only removed if it is expired, because a new lobby
+    // might have taken the name already.
+    void eraseExpired(std::string_view name);
+
+private:
+    static constexpr size_t numShards = 64;
+
+    // Aligned, so that shards that are used by different threads don't share a cache line
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<LobbyKey, std::weak_ptr<Lobby>, LobbyKey::Hash> lobbies;
+    };
+
+    Shard& getShard(const LobbyKey& key);
+    const Shard& getShard(const LobbyKey& key) const;
+
+    std::array<Shard, numShards> shards_;
+};
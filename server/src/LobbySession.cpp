@@ -1,121 +1,186 @@
 #include "LobbySession.hpp"
 
+#include <boost/container/small_vector.hpp>
 #include <spdlog/fmt/ostr.h>
 
+#include "Log.hpp"
 #include "util.hpp"
-#include "words.hpp"
 
-std::string getRandomLobbyName()
+std::optional<Lobby::Player::Id> Lobby::Membership::getPlayerId() const
 {
-    return randomChoice(adjectives) + randomChoice(nouns);
+    const auto id = playerId_.load(std::memory_order_acquire);
+    if (id == noPlayer)
+        return std::nullopt;
+    return static_cast<Player::Id>(id);
 }
 
-Lobby::Lobby(std::string name)
+void Lobby::Membership::setPlayerId(std::optional<Player::Id> id)
+{
+    playerId_.store(id ? *id : noPlayer, std::memory_order_release);
+}
+
+Lobby::Lobby(LobbyContext& context, std::string name, LobbyNameAllocator::Index nameIndex,
+    LobbyHandleTable::Handle handle)
     : name(std::move(name))
+    , nameIndex(nameIndex)
+    , handle(handle)
+    , strand(context.ioContext_.get_executor())
+    , context_(context)
+    , roster_(std::make_shared<const Roster>())
+{
+    stats.liveLobbies.add();
+}
+
+Lobby::~Lobby()
+{
+    context_.removeLobby(*this);
+    stats.liveLobbies.sub();
+}
+
+std::shared_ptr<const Lobby::Roster> Lobby::getRoster() const
+{
+    return std::atomic_load(&roster_);
+}
+
+size_t Lobby::Roster::size() const
 {
+    return size_;
 }
 
-Lobby::Player::Id Lobby::getNextPlayerId() const
+bool Lobby::Roster::contains(Player::Id id) const
 {
-    assert(players.size() < maxPlayers
-        && std::is_sorted(players.begin(), players.end(), Player::IdCompare()));
-    for (size_t i = 0; i < players.size(); ++i) {
-        // players is sorted, so this id is free
-        if (players[i].id != i) {
-            return static_cast<Player::Id>(i);
+    return id < numIds && (usedIds_[id / 64] & (uint64_t(1) << (id % 64)));
+}
+
+std::optional<Lobby::Player::Id> Lobby::Roster::getFreeId() const
+{
+    for (size_t word = 0; word < usedIds_.size(); ++word) {
+        if (~usedIds_[word] != 0) {
+            const auto id = word * 64 + __builtin_ctzll(~usedIds_[word]);
+            if (id < numIds)
+                return static_cast<Player::Id>(id);
         }
     }
-    // No gaps found, return new one
-    return static_cast<Player::Id>(players.size());
+    return std::nullopt;
 }
 
-Lobby::Player::Id Lobby::addPlayer(std::string name, std::weak_ptr<ConnectionBase> connection)
+std::optional<Lobby::Player::Id> Lobby::Roster::getFirstId() const
 {
-    const auto id = getNextPlayerId();
-    players.emplace_back(Player { id, connection, name });
-    std::sort(players.begin(), players.end(), Player::IdCompare());
-    return id;
+    for (size_t word = 0; word < usedIds_.size(); ++word) {
+        if (usedIds_[word] != 0)
+            return static_cast<Player::Id>(word * 64 + __builtin_ctzll(usedIds_[word]));
+    }
+    return std::nullopt;
 }
 
-std::optional<size_t> Lobby::getPlayerIndexById(Player::Id id)
+void Lobby::Roster::add(
+    Player::Id id, std::string_view name, std::weak_ptr<ConnectionBase> connection)
 {
-    for (size_t i = 0; i < players.size(); ++i) {
-        if (players[i].id == id)
-            return i;
+    assert(!contains(id) && name.size() <= Player::Name::static_capacity);
+    if (id >= connections_.size()) {
+        connections_.resize(id + 1);
+        names_.resize(id + 1);
     }
-    return std::nullopt;
+    connections_[id] = std::move(connection);
+    names_[id].assign(name.data(), name.size());
+    usedIds_[id / 64] |= uint64_t(1) << (id % 64);
+    size_++;
 }
 
-void Lobby::removePlayer(Player::Id id)
+void Lobby::Roster::remove(Player::Id id)
 {
-    const auto playerIdx = getPlayerIndexById(id);
-    assert(playerIdx);
-    players.erase(players.begin() + *playerIdx);
+    assert(contains(id));
+    usedIds_[id / 64] &= ~(uint64_t(1) << (id % 64));
+    size_--;
+    connections_[id].reset();
+    names_[id].clear();
+    // Drop the empty slots at the end, so they are not copied with the roster
+    while (!connections_.empty() && !contains(static_cast<Player::Id>(connections_.size() - 1))) {
+        connections_.pop_back();
+        names_.pop_back();
+    }
 }
 
-bool Lobby::canJoin() const
+const std::weak_ptr<ConnectionBase>& Lobby::Roster::getConnection(Player::Id id) const
 {
-    return !locked && players.size() < maxPlayers;
+    assert(contains(id));
+    return connections_[id];
 }
 
-bool Lobby::isPlayerMaster(Player::Id id) const
+std::string_view Lobby::Roster::getName(Player::Id id) const
 {
-    // For now the lowest player id (first element) is master
-    return players.size() > 0 && players.front().id == id;
+    assert(contains(id));
+    return std::string_view(names_[id].data(), names_[id].size());
 }
 
-LobbyContext::LobbyContext(Config config)
-    : config_(std::move(config))
-    , threads_(config.numThreads)
+void Lobby::removePlayer(Player::Id id)
 {
+    auto roster = std::make_shared<Roster>(*roster_);
+    roster->remove(id);
+    std::atomic_store(&roster_, std::shared_ptr<const Roster>(std::move(roster)));
 }
 
-void LobbyContext::run()
+bool Lobby::canJoin() const
 {
-    // Make sure .run doesn't terminate even if there is no work to do
-    auto work { asio::make_work_guard(ioContext_) };
+    return !locked && roster_->size() < maxPlayers;
+}
 
-    for (auto& thread : threads_)
-        thread = std::thread { [&]() { ioContext_.run(); } };
-    spdlog::info("Started {} lobby worker threads", threads_.size());
+bool Lobby::isPlayerMaster(Player::Id id) const
+{
+    // For now the lowest player id is master
+    return roster_->getFirstId() == id;
+}
 
-    for (auto& thread : threads_)
-        thread.join();
-    spdlog::warn("Lobby worker threads joined");
+LobbyContext::LobbyContext(asio::io_context& ioContext, Config config)
+    : ioContext_(ioContext)
+    , config_(std::move(config))
+    , lobbyPool_(stats.lobbyPoolInUse, stats.lobbyPoolFree, maxPooledLobbies)
+{
 }
 
 std::shared_ptr<Lobby> LobbyContext::createLobby()
 {
-    std::unique_lock lock(mutex_);
-    std::string name = getRandomLobbyName();
-    while (lobbies_.find(toLower(name)) != lobbies_.end()) {
-        name = getRandomLobbyName();
-        spdlog::debug(name);
-        spdlog::debug(toLower(name));
-    }
-    const auto lobby = std::make_shared<Lobby>(name);
-    lobbies_.emplace(toLower(name), lobby);
+    const auto nameIndex = lobbyNames_.allocate();
+    if (!nameIndex)
+        return nullptr;
+    const auto name = LobbyNameAllocator::getName(*nameIndex);
+    const auto handle = lobbyHandles_.acquire(*nameIndex);
+    // No live lobby can have this name, because it is only released when its lobby dies
+    const auto lobby = lobbies_.insertIfAbsent(name, [&]() {
+        return std::allocate_shared<Lobby>(
+            PoolAllocator<Lobby>(lobbyPool_), *this, name, *nameIndex, handle);
+    });
+    assert(lobby);
+    lobbyHandles_.set(handle, lobby);
     return lobby;
 }
 
 std::shared_ptr<Lobby> LobbyContext::getLobby(std::string_view name) const
 {
-    std::shared_lock lock(mutex_);
-    const auto it = lobbies_.find(toLower(name));
-    if (it != lobbies_.end())
-        return it->second.lock();
-    else
-        return nullptr;
+    return lobbies_.find(name);
+}
+
+std::shared_ptr<Lobby> LobbyContext::getLobby(LobbyHandleTable::Handle handle) const
+{
+    return lobbyHandles_.find(handle);
+}
+
+void LobbyContext::removeLobby(const Lobby& lobby)
+{
+    lobbies_.eraseExpired(lobby.name);
+    lobbyHandles_.clear(lobby.handle);
+    // Only now nobody can find the lobby anymore, so its name may be given to a new one
+    lobbyNames_.release(lobby.nameIndex);
 }
 
-asio::io_context& LobbyContext::getIoContext()
+const Config& LobbyContext::getConfig() const
 {
-    return ioContext_;
+    return config_;
 }
 
 LobbySession::LobbySession(asio::io_context& ioContext, LobbyContext& context)
-    : ConnectionBase(ioContext)
-    , strand_(context.getIoContext().get_executor())
+    : ConnectionBase(ioContext, context.getConfig())
+    , strand_(ioContext.get_executor())
     , context_(context)
 {
 }
@@ -124,244 +189,332 @@ LobbySession::~LobbySession()
 {
 }
 
-void LobbySession::processReadBuf(asio::streambuf& readBuf)
+void LobbySession::onClose()
+{
+    // Remove the player right away, so the lobby gets an update and doesn't keep a dead entry
+    asio::post(strand_, [me = getSessionPtr()]() {
+        me->sessionClosed_ = true;
+        if (me->lobby_)
+            me->leaveLobby();
+    });
+}
+
+void LobbySession::processReadBuf(RecvBuffer& readBuf)
 {
-    const auto msg = readMessage(readBuf);
-    if (msg) {
-        spdlog::debug("Received message: {}", hexDump(*msg));
+    // A client may pipeline several frames into a single segment, so we have to drain every
+    // complete frame here. Otherwise the remaining ones would sit in readBuf until more bytes
+    // arrive, which might take a long time.
+    // The frames point into the receive buffer's memory, so they are not copied.
+    // Usually there are only few frames per read, so they fit into the handler without allocating.
+    boost::container::small_vector<Frame, 4> msgs;
+    while (auto msg = readBuf.readFrame()) {
+        LOG_DEBUG("Received message: {}", hexDump(msg->view()));
+        msgs.push_back(std::move(*msg));
+    }
+
+    stats.reads.add();
+    stats.framesRead.add(msgs.size());
+
+    if (!msgs.empty()) {
         // We use a strand for all message processing of a single connection, to make sure
         // that the messages are handled in the order they are received.
         // Without the strand it might happen that we receive message A, then B
         // and the processing of A might take longer than B in another thread,
         // so B is responded to before A.
         // We also save a mutex for _lobby and playerId.
-        asio::post(strand_, [me = getSharedPtr(), msg = std::move(*msg)]() {
-            dynamic_cast<LobbySession*>(me.get())->processMessage(msg);
-        });
+        // All frames from one read are dispatched as a single batch, so they only cost one
+        // handler. If the strand is idle, the batch is processed right away on this thread.
+        asio::dispatch(strand_,
+            makeAllocHandler(readHandlerMemory_, [me = getSharedPtr(), msgs = std::move(msgs)]() {
+                const auto session = dynamic_cast<LobbySession*>(me.get());
+                for (const auto& msg : msgs)
+                    session->processMessage(msg);
+            }));
     }
 }
 
-void LobbySession::sendMessage(std::shared_ptr<ConnectionBase> connection, std::string_view data)
+void LobbySession::sendMessage(std::shared_ptr<ConnectionBase> connection, const SendBuffer& frame)
 {
-    BufferWriter wbuf;
-    wbuf.string<uint32_t>(data);
-    const auto msg = wbuf.toString();
-    spdlog::debug("Send: {}", hexDump(msg));
-    connection->send(msg);
+    connection->send(OutMessage { frame });
 }
 
-void LobbySession::sendResponse(std::string_view data)
+std::string_view LobbySession::getBytes(const SendBuffer& frame)
 {
-    sendMessage(getSharedPtr(), data);
+    return std::string_view(static_cast<const char*>(frame.buffer.data()), frame.buffer.size());
 }
 
-// Requires at least shared lock on lobby_
-void LobbySession::sendToAll(std::string_view data)
+void LobbySession::sendResponse(const SendBuffer& frame)
 {
-    for (const auto& player : lobby_->players) {
-        if (auto conn = player.connection.lock())
-            sendMessage(conn, data);
-    }
+    LOG_DEBUG("Send: {}", hexDump(getBytes(frame)));
+    sendMessage(getSharedPtr(), frame);
 }
 
-void LobbySession::encodeLobbyJoined(
-    BufferWriter& wbuf, const std::string& lobbyId, uint8_t playerId)
+void LobbySession::sendToAll(const Lobby& lobby, const SendBuffer& frame)
 {
-    wbuf.integer<uint8_t>(static_cast<uint8_t>(MessageType::lobbyJoined));
-    wbuf.string(lobbyId);
-    wbuf.integer<uint8_t>(playerId);
+    LOG_DEBUG("Send to all: {}", hexDump(getBytes(frame)));
+    // The frame is only encoded once and shared by all recipients
+    const auto roster = lobby.getRoster();
+    roster->forEachId([&](Lobby::Player::Id id) {
+        if (auto conn = roster->getConnection(id).lock())
+            sendMessage(conn, frame);
+    });
 }
 
-// Requires at least shared lock on lobby_
-void LobbySession::encodeLobbyUpdate(BufferWriter& wbuf)
+SendBuffer LobbySession::encodeLobbyUpdate(const Lobby::Roster& roster)
 {
-    wbuf.integer<uint8_t>(static_cast<uint8_t>(MessageType::updateLobby));
-    wbuf.integer<uint8_t>(lobby_->players.size());
-    for (const auto& player : lobby_->players) {
-        wbuf.integer<uint8_t>(player.id);
-        wbuf.string(player.name);
-    }
+    UpdateLobbyMessage msg;
+    roster.forEachId(
+        [&](Lobby::Player::Id id) { msg.players.push_back({ id, roster.getName(id) }); });
+    return encodeMessage(msg);
 }
 
-void LobbySession::processCreateLobby(BufferReader& rbuf)
+void LobbySession::scheduleLobbyUpdate(std::shared_ptr<Lobby> lobby)
 {
-    const auto playerName = rbuf.string();
-    BufferWriter lobbyJoinedBuf, lobbyUpdateBuf;
-    lobby_ = context_.createLobby();
-    {
-        std::unique_lock lock(lobby_->mutex);
-        playerId = lobby_->addPlayer(playerName, getWeakPtr());
-        encodeLobbyJoined(lobbyJoinedBuf, lobby_->name, *playerId);
-        encodeLobbyUpdate(lobbyUpdateBuf);
-        sendResponse(lobbyJoinedBuf.toString());
-        sendToAll(lobbyUpdateBuf.toString());
-    }
+    if (lobby->updateScheduled)
+        return;
+    lobby->updateScheduled = true;
+    // Posting queues the update behind everything that is already waiting on the strand, e.g.
+    // other players that disconnected at the same time.
+    asio::post(lobby->strand, [lobby]() {
+        lobby->updateScheduled = false;
+        sendToAll(*lobby, encodeLobbyUpdate(*lobby->getRoster()));
+        for (const auto& relay : lobby->pendingRelays) {
+            if (const auto playerId = relay.from->getPlayerId())
+                relayMessage(*lobby, *playerId, relay.payload);
+        }
+        lobby->pendingRelays.clear();
+        // Only now may the players in this update relay without going through the strand, so
+        // their relays are not overtaken by their parked ones.
+        lobby->numAnnouncedJoins.store(lobby->numJoins, std::memory_order_release);
+    });
+}
 
-    spdlog::debug("Create lobby {} with player {} (id: {})", lobby_->name, playerName, *playerId);
+SendBuffer LobbySession::makeRelayPayload(const Frame& frame, std::string_view message)
+{
+    if (message.size() > maxCopiedPayloadSize)
+        return SendBuffer { frame.data, asio::buffer(message.data(), message.size()) };
+    auto storage = SendStorage::allocate(message.size());
+    std::memcpy(storage.data.get(), message.data(), message.size());
+    const auto buffer = asio::buffer(storage.data.get(), message.size());
+    return SendBuffer { std::move(storage.data), buffer };
 }
 
-void LobbySession::processJoinLobby(BufferReader& rbuf)
+void LobbySession::relayMessage(
+    const Lobby& lobby, Lobby::Player::Id from, const SendBuffer& payload)
 {
-    const auto playerName = rbuf.string();
-    const auto lobbyId = rbuf.string();
-    lobby_ = context_.getLobby(lobbyId);
-    if (lobby_) {
-        BufferWriter lobbyJoinedBuf, lobbyUpdateBuf;
-        std::unique_lock lock(lobby_->mutex);
-        if (lobby_->canJoin()) {
-            playerId = lobby_->addPlayer(playerName, getWeakPtr());
-            encodeLobbyJoined(lobbyJoinedBuf, lobby_->name, *playerId);
-            encodeLobbyUpdate(lobbyUpdateBuf);
-            sendResponse(lobbyJoinedBuf.toString());
-            sendToAll(lobbyUpdateBuf.toString());
-            spdlog::debug(
-                "Joined lobby {} with player {} (id: {})", lobby_->name, playerName, *playerId);
-        } else {
-            spdlog::debug("Cannot join lobby {}", lobby_->name);
+    // Only the header is encoded, the payload is shared
+    const auto size = payload.buffer.size();
+    const auto header = encodeMessage(
+        RelayMessageHeader { from, static_cast<uint16_t>(size) }, size);
+
+    // The roster snapshot is pinned for the whole fan-out, so joins and leaves don't have to
+    // wait for it. That also means a player who leaves while the fan-out runs may still get the
+    // message. If they already joined another lobby, they see it after that lobby's lobbyJoined,
+    // with a sender id of the old lobby. Clients have to accept that (rare) stray message.
+    const auto roster = lobby.getRoster();
+    roster->forEachId([&](Lobby::Player::Id id) {
+        if (id != from) {
+            if (auto conn = roster->getConnection(id).lock())
+                conn->send(OutMessage { header, payload });
         }
+    });
+}
+
+std::shared_ptr<LobbySession> LobbySession::getSessionPtr()
+{
+    return std::static_pointer_cast<LobbySession>(getSharedPtr());
+}
+
+// The functions below run on strand_ and hand everything that touches a lobby to the lobby's
+// strand. Operations of one session on one lobby are executed in the order they are dispatched,
+// so e.g. a sendMessage after a joinLobby is always processed after the join.
+
+void LobbySession::joinLobby(std::shared_ptr<Lobby> lobby, std::string playerName)
+{
+    if (sessionClosed_)
+        return;
+    if (lobby_)
+        leaveLobby();
+
+    const auto membership = std::make_shared<Lobby::Membership>();
+    lobby_ = lobby;
+    membership_ = membership;
+    asio::dispatch(lobby->strand,
+        [me = getSessionPtr(), lobby, membership, playerName = std::move(playerName)]() {
+            if (!lobby->canJoin()) {
+                LOG_DEBUG("Cannot join lobby {}", lobby->name);
+                // Operations that were dispatched in the meantime see no player id and do nothing
+                asio::post(me->strand_, [me, membership]() {
+                    if (me->membership_ == membership) {
+                        me->lobby_.reset();
+                        me->membership_.reset();
+                    }
+                });
+                return;
+            }
+
+            // The new player's lobbyJoined and a listing of the lobby are queued before the
+            // roster with the player is published. Sends to one connection are queued in the order
+            // they are made, so everything another player relays to it comes after those.
+            const auto playerId = lobby->addPlayer(playerName, me->getWeakPtr(),
+                [&](Lobby::Player::Id id, const Lobby::Roster& roster) {
+                    membership->joinNumber = ++lobby->numJoins;
+                    membership->setPlayerId(id);
+                    me->sendResponse(
+                        encodeMessage(LobbyJoinedMessage { lobby->name, id, lobby->handle }));
+                    me->sendResponse(encodeLobbyUpdate(roster));
+                });
+            // For everybody else
+            scheduleLobbyUpdate(lobby);
+            LOG_DEBUG(
+                "Joined lobby {} with player {} (id: {})", lobby->name, playerName, playerId);
+        });
+}
+
+void LobbySession::leaveLobby()
+{
+    asio::dispatch(lobby_->strand, [lobby = lobby_, membership = membership_]() {
+        const auto playerId = membership->getPlayerId();
+        if (!playerId)
+            return;
+        lobby->removePlayer(*playerId);
+        membership->setPlayerId(std::nullopt);
+        scheduleLobbyUpdate(lobby);
+    });
+    lobby_.reset();
+    membership_.reset();
+}
+
+void LobbySession::process(const CreateLobbyMessage& msg, const Frame& /*frame*/)
+{
+    const auto lobby = context_.createLobby();
+    if (!lobby) {
+        spdlog::error("Could not create lobby, all lobby names are in use");
+        return;
+    }
+    LOG_DEBUG("Create lobby {} for player {}", lobby->name, msg.playerName);
+    joinLobby(lobby, std::string(msg.playerName));
+}
+
+void LobbySession::process(const JoinLobbyMessage& msg, const Frame& /*frame*/)
+{
+    const auto lobby = context_.getLobby(msg.lobbyName);
+    if (lobby) {
+        joinLobby(lobby, std::string(msg.playerName));
     } else {
-        spdlog::info("Attempt to join non-existent lobby {}", lobbyId);
+        spdlog::info("Attempt to join non-existent lobby {}", msg.lobbyName);
     }
 }
 
-void LobbySession::processLeaveLobby(BufferReader& /*rbuf*/)
+void LobbySession::process(const JoinLobbyByHandleMessage& msg, const Frame& /*frame*/)
 {
-    if (lobby_) {
-        {
-            std::unique_lock lock(lobby_->mutex);
-            lobby_->removePlayer(*playerId);
-            playerId = std::nullopt;
-
-            BufferWriter wbuf;
-            encodeLobbyUpdate(wbuf);
-            sendToAll(wbuf.toString());
-        }
-        lobby_.reset();
+    const auto lobby = context_.getLobby(msg.handle);
+    if (lobby) {
+        joinLobby(lobby, std::string(msg.playerName));
+    } else {
+        spdlog::info("Attempt to join non-existent lobby with handle {}", msg.handle);
     }
 }
 
+void LobbySession::process(const LeaveLobbyMessage& /*msg*/, const Frame& /*frame*/)
+{
+    if (lobby_)
+        leaveLobby();
+}
+
 void LobbySession::setLobbyLocked(bool locked)
 {
     if (lobby_) {
-        assert(playerId);
-        std::unique_lock lock(lobby_->mutex);
-        if (lobby_->isPlayerMaster(*playerId))
-            lobby_->locked = locked;
+        asio::dispatch(lobby_->strand, [lobby = lobby_, membership = membership_, locked]() {
+            const auto playerId = membership->getPlayerId();
+            if (playerId && lobby->isPlayerMaster(*playerId))
+                lobby->locked = locked;
+        });
     }
 }
 
-void LobbySession::processLockLobby(BufferReader& /*rbuf*/)
+void LobbySession::process(const LockLobbyMessage& /*msg*/, const Frame& /*frame*/)
 {
     setLobbyLocked(true);
 }
 
-void LobbySession::processUnlockLobby(BufferReader& /*rbuf*/)
+void LobbySession::process(const UnlockLobbyMessage& /*msg*/, const Frame& /*frame*/)
 {
     setLobbyLocked(false);
 }
 
-void LobbySession::processSendMessage(BufferReader& rbuf)
+void LobbySession::process(const SendMessageMessage& msg, const Frame& frame)
 {
-    const auto msg = rbuf.string<uint16_t>();
     if (lobby_) {
-        assert(playerId);
-
-        BufferWriter wbuf;
-        wbuf.integer<uint8_t>(static_cast<uint8_t>(MessageType::relayMessage));
-        wbuf.integer<uint8_t>(*playerId);
-        wbuf.string<uint16_t>(msg);
-        const auto sendMsg = wbuf.toString();
-        {
-            std::shared_lock lock(lobby_->mutex);
-            for (const auto& player : lobby_->players) {
-                if (player.id != *playerId) {
-                    if (auto conn = player.connection.lock())
-                        sendMessage(conn, sendMsg);
+        const auto payload = makeRelayPayload(frame, msg.message);
+        // If the other players have been told about us already, we can fan out from here on a
+        // roster snapshot without going through the lobby's strand. Otherwise we have to queue
+        // the relay behind the join and the update that announces it.
+        const auto playerId = membership_->getPlayerId();
+        if (playerId
+            && membership_->joinNumber
+                <= lobby_->numAnnouncedJoins.load(std::memory_order_acquire)) {
+            relayMessage(*lobby_, *playerId, payload);
+        } else {
+            asio::dispatch(lobby_->strand, [lobby = lobby_, membership = membership_, payload]() {
+                const auto playerId = membership->getPlayerId();
+                if (!playerId)
+                    return;
+                if (membership->joinNumber <= lobby->numAnnouncedJoins.load()) {
+                    relayMessage(*lobby, *playerId, payload);
+                } else {
+                    // The update that announces us is scheduled, but may still be queued
+                    assert(lobby->updateScheduled);
+                    lobby->pendingRelays.push_back({ membership, payload });
                 }
-            }
+            });
         }
     }
 }
 
-void LobbySession::processRequestLobbyUpdate(BufferReader& /*rbuf*/)
+void LobbySession::process(const RequestLobbyUpdateMessage& /*msg*/, const Frame& /*frame*/)
 {
     if (lobby_) {
-        BufferWriter wbuf;
-        {
-            std::shared_lock lock(lobby_->mutex);
-            encodeLobbyUpdate(wbuf);
-        }
-        sendResponse(wbuf.toString());
+        // Sessions whose join is still pending or was rejected must not see the roster
+        asio::dispatch(lobby_->strand,
+            [me = getSessionPtr(), lobby = lobby_, membership = membership_]() {
+                if (membership->getPlayerId())
+                    me->sendResponse(encodeLobbyUpdate(*lobby->getRoster()));
+            });
     }
 }
 
-void LobbySession::processMessage(const std::string& msg)
+void LobbySession::process(const HeartbeatMessage& /*msg*/, const Frame& /*frame*/)
 {
-    BufferReader rbuf(asio::buffer(msg));
-    const auto typeVal = rbuf.integer<uint8_t>();
-    if (typeVal >= static_cast<uint8_t>(MessageType::lastMessageType)) {
-        spdlog::info("Received message with invalid type {}", typeVal);
+    // this message is supposed to be ignored
+}
+
+void LobbySession::processMessage(const Frame& frame)
+{
+    // The read loop may still hand off frames, while the connection is shut down because of a
+    // write error, a slow consumer or a timeout
+    if (sessionClosed_)
+        return;
+    if (frame.size == 0) {
+        spdlog::info("Received empty message");
         return;
     }
-    const auto type = static_cast<MessageType>(typeVal);
-    spdlog::debug("processMessage {}", type);
-    switch (type) {
-    case MessageType::createLobby:
-        processCreateLobby(rbuf);
-        break;
-    case MessageType::joinLobby:
-        processJoinLobby(rbuf);
-        break;
-    case MessageType::leaveLobby:
-        processLeaveLobby(rbuf);
-        break;
-    case MessageType::lockLobby:
-        processLockLobby(rbuf);
-        break;
-    case MessageType::unlockLobby:
-        processUnlockLobby(rbuf);
-        break;
-    case MessageType::sendMessage:
-        processSendMessage(rbuf);
-        break;
-    case MessageType::requestLobbyUpdate:
-        processRequestLobbyUpdate(rbuf);
-        break;
-    case MessageType::heartbeat:
-        // this message is supposed to be ignored
+    BufferReader rbuf(frame.buffer());
+    const auto typeVal = rbuf.integer<uint8_t>();
+    if (typeVal < static_cast<uint8_t>(MessageType::lastMessageType))
+        LOG_DEBUG("processMessage {}", static_cast<MessageType>(typeVal));
+    const auto result = visitMessage<CreateLobbyMessage, JoinLobbyMessage, LeaveLobbyMessage,
+        LockLobbyMessage, UnlockLobbyMessage, SendMessageMessage, RequestLobbyUpdateMessage,
+        HeartbeatMessage, JoinLobbyByHandleMessage>(
+        typeVal, rbuf, [&](const auto& msg) { process(msg, frame); });
+    switch (result) {
+    case DecodeResult::ok:
         break;
-    default:
+    case DecodeResult::unknownType:
         spdlog::info("Received message of unexpected type: {}", typeVal);
         break;
+    case DecodeResult::truncated:
+        spdlog::info("Received truncated {} message", static_cast<MessageType>(typeVal));
+        break;
     }
 }
-
-std::ostream& operator<<(std::ostream& os, LobbySession::MessageType type)
-{
-    switch (type) {
-    case LobbySession::MessageType::createLobby:
-        return os << "createLobby";
-    case LobbySession::MessageType::joinLobby:
-        return os << "joinLobby";
-    case LobbySession::MessageType::lobbyJoined:
-        return os << "lobbyJoined";
-    case LobbySession::MessageType::leaveLobby:
-        return os << "leaveLobby";
-    case LobbySession::MessageType::lockLobby:
-        return os << "lockLobby";
-    case LobbySession::MessageType::unlockLobby:
-        return os << "unlockLobby";
-    case LobbySession::MessageType::sendMessage:
-        return os << "sendMessage";
-    case LobbySession::MessageType::relayMessage:
-        return os << "relayMessage";
-    case LobbySession::MessageType::requestLobbyUpdate:
-        return os << "requestLobbyUpdate";
-    case LobbySession::MessageType::updateLobby:
-        return os << "updateLobby";
-    case LobbySession::MessageType::heartbeat:
-        return os << "heartbeat";
-    default:
-        return os << "Unknown";
-    }
-}
\ No newline at end of file
@@ -1,73 +1,184 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
+#include <cassert>
+#include <optional>
 #include <random>
-#include <shared_mutex>
 
+#include <boost/static_string.hpp>
+
+#include "LobbyHandleTable.hpp"
+#include "LobbyMessages.hpp"
+#include "LobbyNameAllocator.hpp"
+#include "LobbyRegistry.hpp"
 #include "Server.hpp"
 #include "serialization.hpp"
 
+class LobbyContext;
+
 struct Lobby {
     struct Player {
         using Id = uint8_t;
-        Id id;
-        std::weak_ptr<ConnectionBase> connection;
-        std::string name;
-
-        struct IdCompare {
-            bool operator()(const Player& a, const Player& b) const
-            {
-                return a.id < b.id;
-            }
-        };
+        // Names are sent with a one byte length, so they always fit
+        using Name = boost::static_string<std::numeric_limits<uint8_t>::max()>;
+    };
+
+    // A session's membership in a lobby. The player id is assigned when the join is processed
+    // on the lobby's strand and is only written from there, but may be read from anywhere.
+    struct Membership {
+        std::optional<Player::Id> getPlayerId() const;
+        void setPlayerId(std::optional<Player::Id> id);
+
+        // The lobby's join counter at the time of the join. It is written before the player id,
+        // so it is valid for everyone who sees the id.
+        uint64_t joinNumber = 0;
+
+    private:
+        static constexpr int noPlayer = -1;
+
+        std::atomic<int> playerId_ { noPlayer };
     };
 
     static constexpr auto maxPlayers = std::numeric_limits<Player::Id>::max();
 
-    Lobby(std::string name);
+    // A roster is never modified after it has been published, so it can be read from any thread
+    // without waiting for the lobby's strand. Joins and leaves publish a new one.
+    // Players are stored in the slot of their id and a bitmap keeps track of the taken ids, so
+    // adding, removing and finding a player is O(1). The slots only reach up to the highest id in
+    // use, which keeps copies of small rosters small. Connections and names are stored apart, so
+    // fan-outs only walk the connections.
+    class Roster {
+    public:
+        size_t size() const;
+
+        bool contains(Player::Id id) const;
 
-    // Requires at least shared lock
-    Player::Id getNextPlayerId() const;
+        // Returns the lowest free id or nullopt if the roster is full
+        std::optional<Player::Id> getFreeId() const;
 
-    // Requires unique lock
-    Player::Id addPlayer(std::string name, std::weak_ptr<ConnectionBase> connection);
+        // Returns the lowest id in use or nullopt if the roster is empty
+        std::optional<Player::Id> getFirstId() const;
+
+        void add(Player::Id id, std::string_view name, std::weak_ptr<ConnectionBase> connection);
+
+        void remove(Player::Id id);
+
+        const std::weak_ptr<ConnectionBase>& getConnection(Player::Id id) const;
+
+        std::string_view getName(Player::Id id) const;
+
+        // Calls func with the id of every player, in ascending order
+        template <typename Func>
+        void forEachId(Func&& func) const
+        {
+            for (size_t word = 0; word < usedIds_.size(); ++word) {
+                auto bits = usedIds_[word];
+                while (bits) {
+                    const auto bit = __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                    func(static_cast<Player::Id>(word * 64 + bit));
+                }
+            }
+        }
+
+    private:
+        static constexpr size_t numIds = maxPlayers;
+
+        std::array<uint64_t, (numIds + 63) / 64> usedIds_ {};
+        size_t size_ = 0;
+        std::vector<std::weak_ptr<ConnectionBase>> connections_; // indexed by id
+        std::vector<Player::Name> names_; // indexed by id
+    };
 
-    // Requires at least shared lock
-    std::optional<size_t> getPlayerIndexById(Player::Id id);
+    Lobby(LobbyContext& context, std::string name, LobbyNameAllocator::Index nameIndex,
+        LobbyHandleTable::Handle handle);
+    ~Lobby();
+
+    // May be called from any thread. The returned snapshot stays valid as long as it is held.
+    // Note that std::atomic_load on a shared_ptr is not lock-free: libstdc++ takes one of a few
+    // global mutexes (picked by address) for the reference count increment. That lock is only
+    // held for a few instructions and is never held while a fan-out runs.
+    std::shared_ptr<const Roster> getRoster() const;
+
+    // All of the following must only be called from strand
+
+    // Must only be called if canJoin returned true. beforePublish is called with the new id and
+    // roster before the roster is published, i.e. before any fan-out can reach the new player.
+    template <typename Func>
+    Player::Id addPlayer(
+        std::string_view name, std::weak_ptr<ConnectionBase> connection, Func&& beforePublish)
+    {
+        const auto id = roster_->getFreeId();
+        assert(id);
+        auto roster = std::make_shared<Roster>(*roster_);
+        roster->add(*id, name, std::move(connection));
+        beforePublish(*id, static_cast<const Roster&>(*roster));
+        std::atomic_store(&roster_, std::shared_ptr<const Roster>(std::move(roster)));
+        return *id;
+    }
 
-    // Requires unique lock
     void removePlayer(Player::Id id);
 
-    // Requires at least shared lock
     bool canJoin() const;
 
-    // Requires at least shared lock
     bool isPlayerMaster(Player::Id id) const;
 
-    std::string name;
-    std::vector<Player> players;
+    const std::string name;
+    const LobbyNameAllocator::Index nameIndex;
+    const LobbyHandleTable::Handle handle;
+
+    // The lobby is an actor: every operation on it is dispatched to this strand, so it is never
+    // accessed from two threads at once and needs no lock.
+    asio::strand<asio::io_context::executor_type> strand;
+
     bool locked = false;
+    bool updateScheduled = false;
+
+    // Every join is numbered. The relays of a player only bypass strand once an update that lists
+    // the player has been sent, so nobody receives a relayMessage from a player they don't know.
+    uint64_t numJoins = 0;
+    std::atomic<uint64_t> numAnnouncedJoins { 0 }; // may be read from any thread
+
+    // Relays of players that have not been announced yet. They are sent right after the update.
+    struct PendingRelay {
+        std::shared_ptr<Membership> from;
+        SendBuffer payload;
+    };
+    std::vector<PendingRelay> pendingRelays;
 
-    mutable std::shared_mutex mutex;
+private:
+    LobbyContext& context_; // the lobby removes itself from it, when it dies
+
+    // Only replaced on strand (with std::atomic_store), so it can be read there without
+    // std::atomic_load.
+    std::shared_ptr<const Roster> roster_;
 };
 
 class LobbyContext {
 public:
-    LobbyContext(Config config);
+    LobbyContext(asio::io_context& ioContext, Config config);
 
-    void run();
+    const Config& getConfig() const;
 
+    // Returns nullptr if all lobby names are in use
     std::shared_ptr<Lobby> createLobby();
     std::shared_ptr<Lobby> getLobby(std::string_view name) const;
-
-    asio::io_context& getIoContext();
+    std::shared_ptr<Lobby> getLobby(LobbyHandleTable::Handle handle) const;
 
 private:
+    friend struct Lobby;
+
+    static constexpr size_t maxPooledLobbies = 1024;
+
+    // Called by dying lobbies
+    void removeLobby(const Lobby& lobby);
+
+    asio::io_context& ioContext_;
     Config config_;
-    std::vector<std::thread> threads_;
-    asio::io_context ioContext_;
-    std::unordered_map<std::string, std::weak_ptr<Lobby>> lobbies_;
-    mutable std::shared_mutex mutex_;
+    BlockPool lobbyPool_;
+    LobbyNameAllocator lobbyNames_;
+    LobbyHandleTable lobbyHandles_;
+    LobbyRegistry lobbies_;
 };
 
 class LobbySession : public ConnectionBase {
@@ -75,51 +186,63 @@ public:
     LobbySession(asio::io_context& ioContext, LobbyContext& context);
     ~LobbySession();
 
-    void processReadBuf(asio::streambuf& readBuf) override;
+    void processReadBuf(RecvBuffer& readBuf) override;
+
+protected:
+    void onClose() override;
 
 private:
-    enum class MessageType : uint8_t {
-        createLobby = 0, // c -> s
-        joinLobby = 2, // c -> s
-        lobbyJoined = 3, // c <- s
-        leaveLobby = 4, // c -> s
-        lockLobby = 5, // c -> s
-        unlockLobby = 6, // c -> s
-        sendMessage = 7, // c -> s
-        relayMessage = 8, // c <- s
-        requestLobbyUpdate = 9, // c -> s
-        updateLobby = 10, // c <- s
-        heartbeat = 11, // c -> s
-        lastMessageType,
-    };
+    static constexpr size_t maxCopiedPayloadSize = 4096;
+
+    // For logging
+    static std::string_view getBytes(const SendBuffer& frame);
+
+    // The encoded frame can be sent to any number of connections
+    static SendBuffer encodeLobbyUpdate(const Lobby::Roster& roster);
+
+    static void sendMessage(std::shared_ptr<ConnectionBase> connection, const SendBuffer& frame);
+
+    void sendResponse(const SendBuffer& frame);
 
-    friend std::ostream& operator<<(std::ostream& os, MessageType type);
+    static void sendToAll(const Lobby& lobby, const SendBuffer& frame);
 
-    void sendMessage(std::shared_ptr<ConnectionBase> connection, std::string_view data);
+    // Must be called from the strand of lobby. Changes that happen until the update is sent
+    // are coalesced into a single updateLobby message.
+    static void scheduleLobbyUpdate(std::shared_ptr<Lobby> lobby);
 
-    void sendResponse(std::string_view data);
+    // Small messages are copied, so they don't keep the whole receive slab alive until the
+    // slowest recipient has sent them. Bigger ones are sent straight from the received frame.
+    static SendBuffer makeRelayPayload(const Frame& frame, std::string_view message);
 
-    // Requires at least shared lock on lobby_
-    void sendToAll(std::string_view data);
+    static void relayMessage(const Lobby& lobby, Lobby::Player::Id from, const SendBuffer& payload);
 
-    void encodeLobbyJoined(BufferWriter& wbuf, const std::string& lobbyId, uint8_t playerId);
+    std::shared_ptr<LobbySession> getSessionPtr();
 
-    // Requires at least shared lock on lobby_
-    void encodeLobbyUpdate(BufferWriter& wbuf);
+    void joinLobby(std::shared_ptr<Lobby> lobby, std::string playerName);
+    void leaveLobby();
 
-    void processCreateLobby(BufferReader& rbuf);
-    void processJoinLobby(BufferReader& rbuf);
-    void processLeaveLobby(BufferReader& /*rbuf*/);
+    // Every received message is decoded and passed to one of these. The frame owns the memory the
+    // message points into.
+    void process(const CreateLobbyMessage& msg, const Frame& /*frame*/);
+    void process(const JoinLobbyMessage& msg, const Frame& /*frame*/);
+    void process(const JoinLobbyByHandleMessage& msg, const Frame& /*frame*/);
+    void process(const LeaveLobbyMessage& /*msg*/, const Frame& /*frame*/);
     void setLobbyLocked(bool locked);
-    void processLockLobby(BufferReader& /*rbuf*/);
-    void processUnlockLobby(BufferReader& /*rbuf*/);
-    void processSendMessage(BufferReader& rbuf);
-    void processRequestLobbyUpdate(BufferReader& /*rbuf*/);
+    void process(const LockLobbyMessage& /*msg*/, const Frame& /*frame*/);
+    void process(const UnlockLobbyMessage& /*msg*/, const Frame& /*frame*/);
+    void process(const SendMessageMessage& msg, const Frame& frame);
+    void process(const RequestLobbyUpdateMessage& /*msg*/, const Frame& /*frame*/);
+    void process(const HeartbeatMessage& /*msg*/, const Frame& /*frame*/);
 
-    void processMessage(const std::string& msg);
+    void processMessage(const Frame& msg);
 
-    std::optional<size_t> playerId;
+    // These are only accessed from strand_
     std::shared_ptr<Lobby> lobby_;
+    std::shared_ptr<Lobby::Membership> membership_;
+    // Set by onClose. Frames that were decoded before are dropped after that, so a join can't
+    // put the player back into a lobby after they were removed.
+    bool sessionClosed_ = false;
+    HandlerMemory<256, 2> readHandlerMemory_; // for dispatching received frames to strand_
     boost::asio::strand<boost::asio::io_context::executor_type> strand_;
     LobbyContext& context_;
 };
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+// Use this instead of spdlog::debug on hot paths. The arguments (e.g. hexDump) are only evaluated
+// if the debug level is enabled. Release builds never enable it (see server.main.cpp), so there
+// the statement is compiled out completely.
+#ifdef NDEBUG
+#define LOG_DEBUG(...) static_cast<void>(0)
+#else
+#define LOG_DEBUG(...)                                                                             \
+    do {                                                                                           \
+        if (spdlog::should_log(spdlog::level::debug))                                              \
+            spdlog::debug(__VA_ARGS__);                                                            \
+    } while (false)
+#endif
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "serialization.hpp"
+
+// Messages are plain structs that describe their wire format with a static constexpr fields()
+// function. It returns a tuple of the field descriptors below in the order they are sent, e.g.:
+//
+//     struct JoinLobbyByHandleMessage {
+//         static constexpr auto type = MessageType::joinLobbyByHandle;
+//
+//         std::string_view playerName;
+//         uint32_t handle;
+//
+//         static constexpr auto fields()
+//         {
+//             return std::make_tuple(stringField(&JoinLobbyByHandleMessage::playerName),
+//                 integerField(&JoinLobbyByHandleMessage::handle));
+//         }
+//     };
+//
+// The decoders and encoders below are generated from that at compile time.
+
+template <typename Message, typename T>
+struct IntegerField {
+    static constexpr size_t minSize = sizeof(T);
+    static constexpr bool fixedSize = true;
+
+    T Message::*member;
+
+    // The caller guarantees that there are enough bytes left
+    bool read(BufferReader& rbuf, Message& msg, size_t /*minSizeAfter*/) const
+    {
+        msg.*member = rbuf.integer<T>();
+        return true;
+    }
+
+    size_t getSize(const Message& /*msg*/) const
+    {
+        return sizeof(T);
+    }
+
+    void write(BufferWriter& wbuf, const Message& msg) const
+    {
+        wbuf.integer<T>(msg.*member);
+    }
+
+    void write(char*& dest, const Message& msg) const
+    {
+        const T valOrdered = hton(msg.*member);
+        std::memcpy(dest, &valOrdered, sizeof(T));
+        dest += sizeof(T);
+    }
+};
+
+template <typename T, typename Message>
+constexpr IntegerField<Message, T> integerField(T Message::*member)
+{
+    return { member };
+}
+
+// The decoded string points into the frame, so it is only valid as long as that is
+template <typename Message, typename SizeType>
+struct StringField {
+    static constexpr size_t minSize = sizeof(SizeType);
+    static constexpr bool fixedSize = false;
+
+    std::string_view Message::*member;
+
+    bool read(BufferReader& rbuf, Message& msg, size_t minSizeAfter) const
+    {
+        const auto size = rbuf.integer<SizeType>();
+        // The size prefix is covered by the minimum size, so only the string itself is checked
+        if (size > rbuf.remaining() - minSizeAfter)
+            return false;
+        msg.*member = rbuf.stringView(size);
+        return true;
+    }
+
+    size_t getSize(const Message& msg) const
+    {
+        return sizeof(SizeType) + (msg.*member).size();
+    }
+
+    void write(BufferWriter& wbuf, const Message& msg) const
+    {
+        wbuf.string<SizeType>(msg.*member);
+    }
+};
+
+template <typename SizeType = uint8_t, typename Message>
+constexpr StringField<Message, SizeType> stringField(std::string_view Message::*member)
+{
+    return { member };
+}
+
+// A count followed by the elements, which are structs with their own fields(). Lists are only
+// encoded, so they have no read().
+template <typename Message, typename SizeType, typename Container>
+struct ListField {
+    static constexpr size_t minSize = sizeof(SizeType);
+    static constexpr bool fixedSize = false;
+
+    Container Message::*member;
+
+    size_t getSize(const Message& msg) const;
+
+    void write(BufferWriter& wbuf, const Message& msg) const;
+};
+
+template <typename SizeType = uint8_t, typename Message, typename Container>
+constexpr ListField<Message, SizeType, Container> listField(Container Message::*member)
+{
+    return { member };
+}
+
+template <typename Message>
+using MessageFields = decltype(Message::fields());
+
+// The sum of the sizes of the fixed size fields and the size prefixes, starting with field Begin
+template <typename Message, size_t Begin = 0>
+constexpr size_t getMinSize()
+{
+    using Fields = MessageFields<Message>;
+    if constexpr (Begin == std::tuple_size_v<Fields>) {
+        return 0;
+    } else {
+        return std::tuple_element_t<Begin, Fields>::minSize + getMinSize<Message, Begin + 1>();
+    }
+}
+
+template <typename Message>
+constexpr bool isFixedSize()
+{
+    return std::apply(
+        [](auto... fields) { return (true && ... && decltype(fields)::fixedSize); },
+        Message::fields());
+}
+
+template <typename Message, size_t... I>
+bool readFields(BufferReader& rbuf, Message& msg, std::index_sequence<I...>)
+{
+    [[maybe_unused]] constexpr auto fields = Message::fields();
+    return (true && ... && std::get<I>(fields).read(rbuf, msg, getMinSize<Message, I + 1>()));
+}
+
+// Decodes the fields of Message from the rest of rbuf. Trailing bytes are ignored, so fields can
+// be appended to a message without breaking older peers. Returns nullopt if the message is
+// truncated.
+// The minimum size is checked once up front. After that the fixed size fields are read without
+// any checks and only the strings check their own size, so fixed size messages are decoded with
+// a single branch.
+template <typename Message>
+std::optional<Message> decodeMessage(BufferReader& rbuf)
+{
+    constexpr auto numFields = std::tuple_size_v<MessageFields<Message>>;
+    if (rbuf.remaining() < getMinSize<Message>())
+        return std::nullopt;
+    Message msg {};
+    if (!readFields(rbuf, msg, std::make_index_sequence<numFields>()))
+        return std::nullopt;
+    return msg;
+}
+
+// The size of the fields of msg, without the message type
+template <typename Message>
+size_t getFieldsSize(const Message& msg)
+{
+    if constexpr (isFixedSize<Message>()) {
+        return getMinSize<Message>();
+    } else {
+        return std::apply(
+            [&](auto... fields) { return (size_t(0) + ... + fields.getSize(msg)); },
+            Message::fields());
+    }
+}
+
+template <typename Message>
+void writeFields(BufferWriter& wbuf, const Message& msg)
+{
+    if constexpr (isFixedSize<Message>()) {
+        // Everything is written into a single block, without checking the capacity per field
+        auto dest = wbuf.append(getMinSize<Message>());
+        std::apply([&](auto... fields) { (fields.write(dest, msg), ...); }, Message::fields());
+    } else {
+        std::apply([&](auto... fields) { (fields.write(wbuf, msg), ...); }, Message::fields());
+    }
+}
+
+// Encodes the message type and the fields of msg into a single frame. The exact size is computed
+// first, so the storage never has to grow. trailingBytes are sent as a separate buffer (see
+// BufferWriter::finishFrame).
+template <typename Message>
+SendBuffer encodeMessage(const Message& msg, size_t trailingBytes = 0)
+{
+    BufferWriter wbuf(sizeof(uint8_t) + getFieldsSize(msg));
+    wbuf.integer<uint8_t>(static_cast<uint8_t>(Message::type));
+    writeFields(wbuf, msg);
+    return wbuf.finishFrame(trailingBytes);
+}
+
+template <typename Message, typename SizeType, typename Container>
+size_t ListField<Message, SizeType, Container>::getSize(const Message& msg) const
+{
+    size_t size = sizeof(SizeType);
+    for (const auto& elem : msg.*member)
+        size += getFieldsSize(elem);
+    return size;
+}
+
+template <typename Message, typename SizeType, typename Container>
+void ListField<Message, SizeType, Container>::write(BufferWriter& wbuf, const Message& msg) const
+{
+    wbuf.integer<SizeType>((msg.*member).size());
+    for (const auto& elem : msg.*member)
+        writeFields(wbuf, elem);
+}
+
+enum class DecodeResult {
+    ok,
+    unknownType,
+    truncated,
+};
+
+template <typename Message, typename Func>
+DecodeResult decodeAndVisit(BufferReader& rbuf, Func& func)
+{
+    const auto msg = decodeMessage<Message>(rbuf);
+    if (!msg)
+        return DecodeResult::truncated;
+    func(*msg);
+    return DecodeResult::ok;
+}
+
+// Decodes the message of the given type, which must be one of Messages, and calls func with it
+template <typename... Messages, typename Func>
+DecodeResult visitMessage(uint8_t type, BufferReader& rbuf, Func&& func)
+{
+    auto result = DecodeResult::unknownType;
+    ((static_cast<uint8_t>(Messages::type) == type
+         && (result = decodeAndVisit<Messages>(rbuf, func), true))
+        || ...);
+    return result;
+}
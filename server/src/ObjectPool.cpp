@@ -0,0 +1,55 @@
+#include "ObjectPool.hpp"
+
+#include <new>
+
+BlockPool::BlockPool(Counter& blocksInUse, Counter& freeBlocks, size_t maxFreeBlocks)
+    : blocksInUse_(blocksInUse)
+    , freeBlocksCounter_(freeBlocks)
+    , maxFreeBlocks_(maxFreeBlocks)
+{
+    freeBlocks_.reserve(maxFreeBlocks_);
+}
+
+BlockPool::~BlockPool()
+{
+    for (auto block : freeBlocks_)
+        ::operator delete(block, std::align_val_t(blockAlignment_));
+    freeBlocksCounter_.sub(freeBlocks_.size());
+}
+
+void* BlockPool::allocate(size_t size, size_t alignment)
+{
+    {
+        std::lock_guard lock(mutex_);
+        if (blockSize_ == 0) {
+            blockSize_ = size;
+            blockAlignment_ = alignment;
+        }
+        if (size == blockSize_ && alignment == blockAlignment_) {
+            blocksInUse_.add();
+            if (!freeBlocks_.empty()) {
+                const auto block = freeBlocks_.back();
+                freeBlocks_.pop_back();
+                freeBlocksCounter_.sub();
+                return block;
+            }
+        }
+    }
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+void BlockPool::deallocate(void* ptr, size_t size, size_t alignment)
+{
+    {
+        std::lock_guard lock(mutex_);
+        if (size == blockSize_ && alignment == blockAlignment_) {
+            blocksInUse_.sub();
+            if (freeBlocks_.size() < maxFreeBlocks_) {
+                freeBlocks_.push_back(ptr);
+                freeBlocksCounter_.add();
+                return;
+            }
+        }
+    }
+    ::operator delete(ptr, std::align_val_t(alignment));
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Stats.hpp"
+
+// Keeps the memory of freed objects of one type, so it can be handed out again for the next one
+// instead of going through the global allocator. The last freed block is reused first, because
+// it is the most likely to still be in the cache.
+// The block size is fixed by the first allocation (with allocate_shared that is the control block
+// that contains the object). Other sizes are not pooled.
+// Only that block is pooled, not what the object allocates itself. For connections, the receive
+// slabs have their own pool (SlabPool), but the coroutine stack (spawn in Boost 1.74 takes no
+// stack allocator), the strand implementations and the send storage are not pooled.
+class BlockPool {
+public:
+    BlockPool(Counter& blocksInUse, Counter& freeBlocks, size_t maxFreeBlocks);
+    ~BlockPool();
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    void* allocate(size_t size, size_t alignment);
+    void deallocate(void* ptr, size_t size, size_t alignment);
+
+private:
+    Counter& blocksInUse_;
+    Counter& freeBlocksCounter_;
+    size_t maxFreeBlocks_;
+    std::mutex mutex_;
+    size_t blockSize_ = 0;
+    size_t blockAlignment_ = 0;
+    std::vector<void*> freeBlocks_;
+};
+
+// For std::allocate_shared
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(BlockPool& pool)
+        : pool_(&pool)
+    {
+    }
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : pool_(other.pool_)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(pool_->allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n)
+    {
+        pool_->deallocate(ptr, sizeof(T) * n, alignof(T));
+    }
+
+    bool operator==(const PoolAllocator& other) const noexcept
+    {
+        return pool_ == other.pool_;
+    }
+
+    bool operator!=(const PoolAllocator& other) const noexcept
+    {
+        return pool_ != other.pool_;
+    }
+
+private:
+    template <typename>
+    friend class PoolAllocator;
+
+    BlockPool* pool_;
+};
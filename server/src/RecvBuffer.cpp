@@ -0,0 +1,240 @@
+#include "RecvBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+#include "Stats.hpp"
+#include "serialization.hpp"
+
+Slab::Slab(size_t capacity)
+    : data(new char[capacity])
+    , capacity(capacity)
+{
+    stats.slabBytes.add(capacity);
+}
+
+Slab::~Slab()
+{
+    stats.slabBytes.sub(capacity);
+}
+
+SlabPool& SlabPool::instance()
+{
+    static SlabPool pool;
+    return pool;
+}
+
+std::optional<size_t> SlabPool::getSizeClass(size_t size)
+{
+    for (size_t i = 0; i < numSizeClasses; ++i) {
+        if (size <= (size_t(1) << (minSlabSizeLog2 + i)))
+            return i;
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<Slab> SlabPool::makeShared(Slab* slab)
+{
+    return std::shared_ptr<Slab>(slab, [](Slab* slab) { instance().release(slab); });
+}
+
+std::shared_ptr<Slab> SlabPool::acquire(size_t minSize)
+{
+    const auto sizeClass = getSizeClass(minSize);
+    if (!sizeClass)
+        return makeShared(new Slab(minSize));
+
+    {
+        std::lock_guard lock(mutex_);
+        auto& freeList = freeLists_[*sizeClass];
+        if (!freeList.empty()) {
+            auto slab = std::move(freeList.back());
+            freeList.pop_back();
+            stats.pooledSlabBytes.sub(slab->capacity);
+            return makeShared(slab.release());
+        }
+    }
+    return makeShared(new Slab(size_t(1) << (minSlabSizeLog2 + *sizeClass)));
+}
+
+void SlabPool::release(Slab* slab)
+{
+    std::unique_ptr<Slab> owned(slab);
+    const auto sizeClass = getSizeClass(slab->capacity);
+    // Only slabs that have exactly the size of their class are pooled
+    if (!sizeClass || slab->capacity != (size_t(1) << (minSlabSizeLog2 + *sizeClass)))
+        return;
+
+    std::lock_guard lock(mutex_);
+    auto& freeList = freeLists_[*sizeClass];
+    if (freeList.size() < maxFreeSlabs) {
+        stats.pooledSlabBytes.add(owned->capacity);
+        freeList.push_back(std::move(owned));
+    }
+}
+
+RecvBuffer::RecvBuffer(const Config& config)
+    : config_(config)
+    , sizeHint_(config.recvBufferMinSize)
+{
+}
+
+RecvBuffer::~RecvBuffer()
+{
+    stats.pendingInboundBytes.sub(size());
+}
+
+asio::mutable_buffer RecvBuffer::prepare(size_t minSize)
+{
+    const auto pending = size();
+    if (!slab_ || slab_->capacity - end_ < minSize) {
+        const auto required = pending + minSize;
+        // If no frames from this slab are in flight anymore, we can reuse it. The acquire fence
+        // pairs with the release of the last frame on another thread.
+        if (slab_ && slab_.use_count() == 1 && slab_->capacity >= required) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::memmove(slab_->data.get(), slab_->data.get() + begin_, pending);
+        } else {
+            auto slab = SlabPool::instance().acquire(required);
+            if (pending > 0)
+                std::memcpy(slab->data.get(), slab_->data.get() + begin_, pending);
+            slab_ = std::move(slab);
+        }
+        begin_ = 0;
+        end_ = pending;
+    }
+    return asio::buffer(slab_->data.get() + end_, slab_->capacity - end_);
+}
+
+asio::mutable_buffer RecvBuffer::prepareRead()
+{
+    if (config_.recvBufferPolicy == Config::RecvBufferPolicy::fixed)
+        return prepare(config_.recvBufferMinSize);
+
+    const auto wanted = std::max(sizeHint_, getMissingFrameBytes());
+    return prepare(std::clamp(wanted, config_.recvBufferMinSize, config_.recvBufferMaxSize));
+}
+
+void RecvBuffer::commit(size_t size, Clock::time_point now)
+{
+    assert(slab_ && end_ + size <= slab_->capacity);
+    end_ += size;
+    stats.pendingInboundBytes.add(size);
+    lastCommit_ = now;
+    if (!partialFrameStart_)
+        partialFrameStart_ = now;
+
+    if (config_.recvBufferPolicy == Config::RecvBufferPolicy::adaptive) {
+        // If a frame is still incomplete, we want to read all of it with the next read. If the
+        // read filled the buffer, there is probably more waiting, so the next read gets bigger.
+        const auto filled = end_ == slab_->capacity;
+        const auto needed = std::max(filled ? size * 2 : size, getMissingFrameBytes());
+        if (needed > sizeHint_ / 2) {
+            sizeHint_ = std::min(std::max(needed, sizeHint_), config_.recvBufferMaxSize);
+            lastLargeRead_ = now;
+        } else if (now - lastLargeRead_
+            > std::chrono::milliseconds(config_.recvBufferShrinkDelay)) {
+            sizeHint_ = config_.recvBufferMinSize;
+        }
+    }
+}
+
+std::optional<Frame> RecvBuffer::readFrame()
+{
+    while (!failed_) {
+        if (discardRemaining_ > 0) {
+            const auto n = std::min(discardRemaining_, size());
+            consume(n);
+            discardRemaining_ -= n;
+            if (discardRemaining_ > 0)
+                return std::nullopt;
+            // Whatever is left was received with the last read
+            partialFrameStart_ = size() > 0 ? std::optional(lastCommit_) : std::nullopt;
+        }
+
+        if (size() < sizeof(uint32_t))
+            return std::nullopt;
+
+        uint32_t msgSize = 0;
+        std::memcpy(&msgSize, slab_->data.get() + begin_, sizeof(uint32_t));
+        const auto frameSize = sizeof(uint32_t) + ntoh(msgSize);
+        if (frameSize > config_.maxFrameSize || exceedsInboundLimit(frameSize)) {
+            if (config_.oversizedFramePolicy == Config::OversizedFramePolicy::close) {
+                stats.oversizedFramesClosed.add();
+                failed_ = true;
+                return std::nullopt;
+            }
+            stats.oversizedFramesDiscarded.add();
+            discardRemaining_ = frameSize;
+            continue;
+        }
+
+        if (size() < frameSize)
+            return std::nullopt;
+
+        // The frame shares ownership of the slab, but points to the message itself
+        Frame frame { std::shared_ptr<const char>(
+                          slab_, slab_->data.get() + begin_ + sizeof(uint32_t)),
+            frameSize - sizeof(uint32_t) };
+        consume(frameSize);
+        partialFrameStart_ = size() > 0 ? std::optional(lastCommit_) : std::nullopt;
+        return frame;
+    }
+    return std::nullopt;
+}
+
+bool RecvBuffer::hasFailed() const
+{
+    return failed_;
+}
+
+void RecvBuffer::releaseIfEmpty()
+{
+    if (config_.recvBufferPolicy == Config::RecvBufferPolicy::adaptive && size() == 0) {
+        slab_.reset();
+        begin_ = 0;
+        end_ = 0;
+    }
+}
+
+size_t RecvBuffer::size() const
+{
+    return end_ - begin_;
+}
+
+std::optional<RecvBuffer::Clock::time_point> RecvBuffer::getPartialFrameStart() const
+{
+    return partialFrameStart_;
+}
+
+size_t RecvBuffer::getMissingFrameBytes() const
+{
+    if (discardRemaining_ > 0)
+        return discardRemaining_ > size() ? discardRemaining_ - size() : 0;
+
+    if (size() < sizeof(uint32_t))
+        return sizeof(uint32_t) - size();
+
+    uint32_t msgSize = 0;
+    std::memcpy(&msgSize, slab_->data.get() + begin_, sizeof(uint32_t));
+    const auto frameSize = sizeof(uint32_t) + ntoh(msgSize);
+    return frameSize > size() ? frameSize - size() : 0;
+}
+
+bool RecvBuffer::exceedsInboundLimit(size_t frameSize) const
+{
+    if (config_.maxInboundBytes == 0 || size() >= frameSize)
+        return false;
+    // Only bytes that are still waiting for their frame to complete count. Frames that have been
+    // handed off may keep their slab alive for a while (e.g. a big message that is relayed to a
+    // slow consumer), but that should not make other connections drop their frames.
+    return stats.pendingInboundBytes.get() + (frameSize - size()) > config_.maxInboundBytes;
+}
+
+void RecvBuffer::consume(size_t n)
+{
+    begin_ += n;
+    stats.pendingInboundBytes.sub(n);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+
+#include "Config.hpp"
+
+namespace asio = boost::asio;
+
+// A chunk of receive memory. Frames decoded from it keep it alive, so they can be passed
+// to other threads without copying the bytes out of it.
+struct Slab {
+    Slab(size_t capacity);
+    ~Slab();
+
+    std::unique_ptr<char[]> data;
+    size_t capacity;
+};
+
+// Slabs are returned to the pool when the last reference to them is dropped.
+class SlabPool {
+public:
+    static SlabPool& instance();
+
+    std::shared_ptr<Slab> acquire(size_t minSize);
+
+private:
+    static constexpr size_t minSlabSizeLog2 = 12; // 4 KiB
+    static constexpr size_t numSizeClasses = 9; // up to 1 MiB
+    static constexpr size_t maxFreeSlabs = 64; // per size class
+
+    static std::shared_ptr<Slab> makeShared(Slab* slab);
+
+    static std::optional<size_t> getSizeClass(size_t size);
+
+    void release(Slab* slab);
+
+    std::mutex mutex_;
+    std::array<std::vector<std::unique_ptr<Slab>>, numSizeClasses> freeLists_;
+};
+
+// A single message (without the length prefix) pointing into the slab it was received into.
+struct Frame {
+    std::shared_ptr<const char> data;
+    size_t size;
+
+    asio::const_buffer buffer() const
+    {
+        return asio::buffer(data.get(), size);
+    }
+
+    std::string_view view() const
+    {
+        return std::string_view(data.get(), size);
+    }
+};
+
+// Receive buffer for a single connection. It replaces asio::streambuf, so that frames can be
+// handed out as views into the memory the socket read into.
+// With the adaptive policy the read size follows the observed frame and read sizes and falls
+// back to the minimum after the shrink delay. The slab is released
+// completely whenever the buffer is drained, so idle connections do not hold any memory.
+class RecvBuffer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RecvBuffer(const Config& config);
+    ~RecvBuffer();
+
+    // Returns all free space at the end of the buffer, which is at least minSize bytes.
+    asio::mutable_buffer prepare(size_t minSize);
+
+    // Like prepare, but the size is chosen by the policy
+    asio::mutable_buffer prepareRead();
+
+    // now is the time the bytes were received
+    void commit(size_t size, Clock::time_point now = Clock::now());
+
+    // Returns the next complete length-prefixed frame, if there is one.
+    // Frames that exceed maxFrameSize (or would exceed maxInboundBytes) are either skipped while
+    // they stream in or make the buffer fail, depending on oversizedFramePolicy.
+    std::optional<Frame> readFrame();
+
+    // If this is true, the connection should be closed
+    bool hasFailed() const;
+
+    // Drops the slab if there are no pending bytes (and the policy allows it)
+    void releaseIfEmpty();
+
+    // Number of received bytes that have not been consumed by readFrame yet
+    size_t size() const;
+
+    // The time the first byte of the incomplete frame at the front of the buffer was received
+    std::optional<Clock::time_point> getPartialFrameStart() const;
+
+private:
+    // Number of bytes missing to complete the frame at the front of the buffer
+    size_t getMissingFrameBytes() const;
+
+    bool exceedsInboundLimit(size_t frameSize) const;
+
+    // Drops n bytes from the front of the buffer
+    void consume(size_t n);
+
+    const Config& config_;
+    std::shared_ptr<Slab> slab_;
+    size_t begin_ = 0;
+    size_t end_ = 0;
+    size_t discardRemaining_ = 0;
+    bool failed_ = false;
+    size_t sizeHint_;
+    Clock::time_point lastLargeRead_;
+    Clock::time_point lastCommit_;
+    std::optional<Clock::time_point> partialFrameStart_;
+};
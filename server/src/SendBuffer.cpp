@@ -0,0 +1,35 @@
+#include "SendBuffer.hpp"
+
+// The constructor leaves data uninitialized on purpose
+template <size_t Size>
+struct StorageBlock {
+    StorageBlock()
+    {
+    }
+
+    char data[Size];
+};
+
+template <size_t Size>
+SendStorage allocateBlock()
+{
+    const auto block = std::make_shared<StorageBlock<Size>>();
+    return SendStorage { std::shared_ptr<char>(block, block->data), Size };
+}
+
+SendStorage SendStorage::allocate(size_t minCapacity)
+{
+    if (minCapacity <= 64)
+        return allocateBlock<64>();
+    if (minCapacity <= 256)
+        return allocateBlock<256>();
+    if (minCapacity <= 1024)
+        return allocateBlock<1024>();
+    if (minCapacity <= 4096)
+        return allocateBlock<4096>();
+    if (minCapacity <= 16 * 1024)
+        return allocateBlock<16 * 1024>();
+    // Bigger messages are rare, so they are not worth keeping around
+    auto data = std::shared_ptr<char>(new char[minCapacity], std::default_delete<char[]>());
+    return SendStorage { std::move(data), minCapacity };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+#include <boost/asio/buffer.hpp>
+
+namespace asio = boost::asio;
+
+// An immutable piece of an outgoing message. owner keeps the memory alive, so the same bytes can
+// be queued for many connections without copying them.
+struct SendBuffer {
+    std::shared_ptr<const void> owner;
+    asio::const_buffer buffer;
+};
+
+// Memory to encode an outgoing message into, which becomes the owner of its SendBuffer.
+// The common sizes are rounded up to a few size classes and allocated together with their control
+// block. That is a single allocation, which malloc serves from its per-thread cache, without a
+// lock. Storage is freed on whichever thread sends it last, so a shared pool would need a lock.
+struct SendStorage {
+    // The capacity may be bigger than minCapacity
+    static SendStorage allocate(size_t minCapacity);
+
+    std::shared_ptr<char> data;
+    size_t capacity = 0;
+};
@@ -1,11 +1,20 @@
 #include "Server.hpp"
 
+#include "Log.hpp"
 #include "util.hpp"
 
-ConnectionBase::ConnectionBase(asio::io_context& ioContext)
+ConnectionBase::ConnectionBase(asio::io_context& ioContext, const Config& config)
     : ioContext_(ioContext)
     , writeStrand_(ioContext.get_executor())
     , socket_(ioContext_)
+    , readBuf_(config)
+    , maxWriteBytes_(config.maxWriteBytes)
+    , maxWriteBuffers_(config.maxWriteBuffers)
+    , maxSendQueueBytes_(config.maxSendQueueBytes)
+    , maxSendQueueMessages_(config.maxSendQueueMessages)
+    , slowConsumerPolicy_(config.slowConsumerPolicy)
+    , heartbeatTimeout_(std::chrono::milliseconds(config.heartbeatTimeout))
+    , frameTimeout_(std::chrono::milliseconds(config.frameTimeout))
 {
 }
 
@@ -24,66 +33,262 @@ std::weak_ptr<ConnectionBase> ConnectionBase::getWeakPtr()
     return weak_from_this();
 }
 
-void ConnectionBase::read()
+void ConnectionBase::start()
 {
-    // We pass in a shared_ptr to ourselves, so as long as the connection lives
-    // and read will call itself, this object stays alive.
-    const auto buffers = readBuf_.prepare(512);
-    socket_.async_read_some(asio::buffer(buffers),
-        [me = this->shared_from_this()](
-            const error_code& error, size_t size) { me->readBuf(error, size); });
+    lastReceive_.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+    // The read loop is a single long-lived coroutine that holds a shared_ptr to ourselves, so as
+    // long as it runs, this object stays alive. Writes are plain completion handlers, so a
+    // connection only needs a single coroutine stack.
+    // The stack must also have room for a signal handler, which may need more on some CPUs
+    const auto stackSize
+        = std::max(coroutineStackSize, boost::coroutines::stack_traits::minimum_size());
+    asio::spawn(
+        ioContext_,
+        [me = this->shared_from_this()](asio::yield_context yield) { me->readLoop(yield); },
+        boost::coroutines::attributes(stackSize));
 }
 
-void ConnectionBase::send(std::string msg)
+void ConnectionBase::send(OutMessage msg)
 {
-    spdlog::debug("ConnectionBase::send ({}): {}", threadIdStr(), hexDump(msg));
+    LOG_DEBUG("ConnectionBase::send ({}): {} buffers", threadIdStr(), msg.size());
     // We cannot send from multiple threads, so we need a strand
-    asio::post(writeStrand_, [me = this->shared_from_this(), msg = std::move(msg)]() {
-        spdlog::debug("in lambda ({}): {}", threadIdStr(), hexDump(msg));
+    auto handler = [me = this->shared_from_this(), msg = std::move(msg)]() mutable {
         me->queueMessage(std::move(msg));
-    });
+    };
+    asio::post(writeStrand_, makeAllocHandler(writeHandlerMemory_, std::move(handler)));
 }
 
-void ConnectionBase::readBuf(const error_code& error, size_t size)
+void ConnectionBase::close()
 {
-    if (error)
+    auto handler = [me = this->shared_from_this()]() { me->shutdown(); };
+    asio::post(writeStrand_, makeAllocHandler(writeHandlerMemory_, std::move(handler)));
+}
+
+void ConnectionBase::shutdown()
+{
+    if (closed_)
         return;
+    closed_ = true;
+    // The readLoop may be using the socket on another thread right now, so it must not be closed
+    // here. Otherwise its descriptor might be reused by a new connection while the readLoop still
+    // reads from it. Shutting it down makes the readLoop stop, which then closes the socket.
+    error_code ec;
+    socket_.shutdown(tcp::socket::shutdown_both, ec);
+    onClose();
+}
 
-    readBuf_.commit(size);
+std::optional<ConnectionBase::Clock::time_point> ConnectionBase::checkTimeout(
+    Clock::time_point now)
+{
+    auto deadline = Clock::time_point::max();
 
-    processReadBuf(readBuf_);
+    if (heartbeatTimeout_ > Clock::duration::zero()) {
+        const auto lastReceive = lastReceive_.load(std::memory_order_relaxed);
+        const auto heartbeatDeadline = Clock::time_point(Clock::duration(lastReceive))
+            + heartbeatTimeout_;
+        if (heartbeatDeadline <= now) {
+            spdlog::info("Closing connection after heartbeat timeout");
+            stats.heartbeatTimeouts.add();
+            close();
+            return std::nullopt;
+        }
+        deadline = heartbeatDeadline;
+    }
 
-    read();
+    // This catches clients that send a frame very slowly or never finish it
+    if (frameTimeout_ > Clock::duration::zero()) {
+        const auto frameStart = partialFrameStart_.load(std::memory_order_relaxed);
+        if (frameStart != noPartialFrame) {
+            const auto frameDeadline
+                = Clock::time_point(Clock::duration(frameStart)) + frameTimeout_;
+            if (frameDeadline <= now) {
+                spdlog::info("Closing connection after frame timeout");
+                stats.frameTimeouts.add();
+                close();
+                return std::nullopt;
+            }
+            deadline = std::min(deadline, frameDeadline);
+        } else {
+            // Receiving doesn't touch the wheel, so we have to look again before a frame that
+            // starts right after this check could time out. It is caught within 2 * frameTimeout.
+            deadline = std::min(deadline, now + frameTimeout_);
+        }
+    }
+
+    return deadline;
 }
 
-void ConnectionBase::queueMessage(std::string msg)
+void ConnectionBase::readLoop(asio::yield_context yield)
 {
-    const bool writeInProgress = !sendQueue_.empty();
-    // We don't have to protect sendQueue_ here, because this function (and all others that
-    // access sendQueue_) is called from the writeStrand_
-    sendQueue_.emplace_back(std::move(msg));
+#ifdef BOOST_ASIO_HAS_IO_URING
+    while (true) {
+        // The read itself is submitted to the ring, where it is batched with the reads and writes
+        // of all other connections. The buffer has to be provided up front, so with this backend
+        // a waiting connection holds a receive buffer.
+        error_code ec;
+        const auto size = socket_.async_read_some(readBuf_.prepareRead(), yield[ec]);
+        if (ec)
+            break;
+#else
+    socket_.non_blocking(true);
+
+    // We read first and only wait for the socket to become readable if there was nothing to read,
+    // so a read costs a single syscall as long as data keeps coming. A read that does not fill the
+    // buffer has drained the socket, so we wait right away instead of trying a read that would
+    // fail. No receive buffer is held while the connection waits.
+    bool wait = true;
+    while (true) {
+        error_code ec;
+        if (wait) {
+            readBuf_.releaseIfEmpty();
+            socket_.async_wait(tcp::socket::wait_read, yield[ec]);
+            if (ec)
+                break;
+        }
+
+        const auto buffer = readBuf_.prepareRead();
+        const auto size = socket_.read_some(buffer, ec);
+        if (ec == asio::error::would_block) {
+            wait = true;
+            continue;
+        } else if (ec) {
+            break;
+        }
+        wait = size < buffer.size();
+#endif
+
+        const auto now = Clock::now();
+        readBuf_.commit(size, now);
+        lastReceive_.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+
+        processReadBuf(readBuf_);
 
-    // sendFromQueue will end up calling itself if there is still something to send,
-    // but if there is not, we have to kick it off again
-    if (!writeInProgress) {
-        sendFromQueue();
+        const auto frameStart = readBuf_.getPartialFrameStart();
+        partialFrameStart_.store(
+            frameStart ? frameStart->time_since_epoch().count() : noPartialFrame,
+            std::memory_order_relaxed);
+
+        if (readBuf_.hasFailed()) {
+            spdlog::info("Closing connection after oversized frame");
+            break;
+        }
     }
+
+    // Nothing reads from the socket anymore, so it can be closed. That has to happen on the
+    // writeStrand_, so it does not race with a write in progress.
+    auto handler = [me = this->shared_from_this()]() {
+        me->shutdown();
+        error_code ec;
+        me->socket_.close(ec);
+    };
+    asio::post(writeStrand_, makeAllocHandler(writeHandlerMemory_, std::move(handler)));
 }
 
-void ConnectionBase::sendFromQueue()
+void ConnectionBase::startWrite()
 {
-    asio::async_write(socket_, asio::buffer(sendQueue_.front()),
-        asio::bind_executor(
-            writeStrand_, [me = this->shared_from_this()](const error_code& error, size_t) {
-                me->sendDone(error);
-            }));
+    // Everything that is queued is written with a single gather write, so a burst of messages does
+    // not cost one syscall and one strand round trip each.
+    // Only whole messages are written, so queueMessage may drop any message that is not in
+    // writeBuffers_ while the write is in progress.
+    writeBuffers_.clear();
+    for (const auto& msg : sendQueue_) {
+        const auto msgBytes = getSize(msg);
+        if (numWritingMessages_ > 0
+            && (writeBuffers_.size() + msg.size() > maxWriteBuffers_
+                || numWritingBytes_ + msgBytes > maxWriteBytes_))
+            break;
+        for (const auto& buf : msg)
+            writeBuffers_.push_back(buf.buffer);
+        numWritingBytes_ += msgBytes;
+        numWritingMessages_++;
+    }
+
+    auto handler = [me = this->shared_from_this()](const error_code& ec, size_t /*size*/) {
+        me->handleWrite(ec);
+    };
+    asio::async_write(socket_, writeBuffers_,
+        asio::bind_executor(writeStrand_, makeAllocHandler(writeOpMemory_, std::move(handler))));
 }
 
-void ConnectionBase::sendDone(const error_code& error)
+void ConnectionBase::handleWrite(const error_code& ec)
 {
-    if (!error) {
-        sendQueue_.pop_front();
-        if (!sendQueue_.empty())
-            sendFromQueue();
+    if (!ec) {
+        stats.writes.add();
+        stats.buffersWritten.add(writeBuffers_.size());
     }
+    sendQueue_.erase(sendQueue_.begin(), sendQueue_.begin() + numWritingMessages_);
+    queuedBytes_ -= numWritingBytes_;
+    numWritingMessages_ = 0;
+    numWritingBytes_ = 0;
+
+    if (ec) {
+        shutdown();
+    }
+    if (closed_) {
+        // The buffers are not referenced by a write anymore, so we can free them now
+        sendQueue_.clear();
+        queuedBytes_ = 0;
+        return;
+    }
+    if (!sendQueue_.empty())
+        startWrite();
+}
+
+size_t ConnectionBase::getSize(const OutMessage& msg)
+{
+    size_t size = 0;
+    for (const auto& buf : msg)
+        size += buf.buffer.size();
+    return size;
+}
+
+bool ConnectionBase::exceedsSendQueueLimit(size_t msgBytes) const
+{
+    return sendQueue_.size() + 1 > maxSendQueueMessages_
+        || queuedBytes_ + msgBytes > maxSendQueueBytes_;
+}
+
+void ConnectionBase::queueMessage(OutMessage msg)
+{
+    if (closed_)
+        return;
+
+    // We don't have to protect sendQueue_ here, because this function (and all others that
+    // access sendQueue_) is called from the writeStrand_
+    const auto msgBytes = getSize(msg);
+    if (exceedsSendQueueLimit(msgBytes)) {
+        switch (slowConsumerPolicy_) {
+        case Config::SlowConsumerPolicy::dropOldest:
+            // Messages that are currently being written cannot be dropped
+            while (exceedsSendQueueLimit(msgBytes) && sendQueue_.size() > numWritingMessages_) {
+                const auto it = sendQueue_.begin() + numWritingMessages_;
+                queuedBytes_ -= getSize(*it);
+                sendQueue_.erase(it);
+                stats.slowConsumerDrops.add();
+            }
+            if (exceedsSendQueueLimit(msgBytes)) {
+                stats.slowConsumerDrops.add();
+                return;
+            }
+            break;
+        case Config::SlowConsumerPolicy::dropNew:
+            stats.slowConsumerDrops.add();
+            return;
+        case Config::SlowConsumerPolicy::disconnect:
+            spdlog::info("Closing connection of slow consumer");
+            stats.slowConsumerDisconnects.add();
+            // We are on the writeStrand_ already, so closed_ is set right away and the messages
+            // that arrive before the connection is gone return early above
+            shutdown();
+            return;
+        }
+    }
+
+    sendQueue_.push_back(std::move(msg));
+    queuedBytes_ += msgBytes;
+
+    // Otherwise the message is written by handleWrite, when the write in progress is done
+    if (numWritingMessages_ == 0)
+        startWrite();
 }
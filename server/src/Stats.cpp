@@ -0,0 +1,35 @@
+#include "Stats.hpp"
+
+#include <spdlog/spdlog.h>
+
+Stats stats;
+
+void Stats::log() const
+{
+    const auto numReads = reads.get();
+    const auto numFrames = framesRead.get();
+    const auto framesPerRead = numReads > 0 ? static_cast<double>(numFrames) / numReads : 0.0;
+    spdlog::info("Stats: reads: {}, frames: {} ({:.2f} frames/read)", numReads, numFrames,
+        framesPerRead);
+    const auto numWrites = writes.get();
+    const auto numBuffers = buffersWritten.get();
+    const auto buffersPerWrite = numWrites > 0 ? static_cast<double>(numBuffers) / numWrites : 0.0;
+    spdlog::info("Stats: writes: {}, buffers: {} ({:.2f} buffers/write)", numWrites, numBuffers,
+        buffersPerWrite);
+    spdlog::info("Stats: receive slabs: {} bytes ({} bytes pooled), {} bytes pending",
+        slabBytes.get(), pooledSlabBytes.get(), pendingInboundBytes.get());
+    spdlog::info("Stats: oversized frames: {} discarded, {} connections closed",
+        oversizedFramesDiscarded.get(), oversizedFramesClosed.get());
+    spdlog::info("Stats: slow consumers: {} messages dropped, {} disconnected",
+        slowConsumerDrops.get(), slowConsumerDisconnects.get());
+    spdlog::info("Stats: handler heap allocations: {}", handlerHeapAllocations.get());
+    spdlog::info("Stats: timeouts: {} heartbeat, {} frame", heartbeatTimeouts.get(),
+        frameTimeouts.get());
+    spdlog::info("Stats: pools: connections: {} in use, {} free, lobbies: {} in use, {} free",
+        connectionPoolInUse.get(), connectionPoolFree.get(), lobbyPoolInUse.get(),
+        lobbyPoolFree.get());
+    const auto numLobbies = liveLobbies.get();
+    const auto numEntries = registryEntries.get();
+    spdlog::info("Stats: lobbies: {} live, {} registry entries ({} dead)", numLobbies, numEntries,
+        numEntries > numLobbies ? numEntries - numLobbies : 0);
+}
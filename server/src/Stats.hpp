@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+class Counter {
+public:
+    void add(uint64_t n = 1)
+    {
+        value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void sub(uint64_t n = 1)
+    {
+        value_.fetch_sub(n, std::memory_order_relaxed);
+    }
+
+    uint64_t get() const
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> value_ { 0 };
+};
+
+// Process-wide counters. These are only updated with relaxed atomics, so they are cheap enough
+// to be touched on the hot path, but a snapshot of several counters is not necessarily consistent.
+struct Stats {
+    Counter reads;
+    Counter framesRead;
+    Counter writes;
+    Counter buffersWritten;
+    Counter slabBytes; // all allocated receive slabs, including pooled ones
+    Counter pooledSlabBytes;
+    Counter pendingInboundBytes; // received bytes that have not been handed off as frames yet
+    Counter oversizedFramesDiscarded;
+    Counter oversizedFramesClosed; // connections closed because of an oversized frame
+    Counter slowConsumerDrops; // messages dropped because a send queue was full
+    Counter slowConsumerDisconnects;
+    Counter handlerHeapAllocations; // handlers that did not fit into their HandlerMemory
+    Counter liveLobbies;
+    Counter registryEntries;
+    Counter heartbeatTimeouts; // connections closed because nothing was received in time
+    Counter frameTimeouts; // connections closed because a frame was not completed in time
+    Counter connectionPoolInUse;
+    Counter connectionPoolFree;
+    Counter lobbyPoolInUse;
+    Counter lobbyPoolFree;
+
+    void log() const;
+};
+
+extern Stats stats;
@@ -0,0 +1,69 @@
+#include "TimeoutWheel.hpp"
+
+#include <algorithm>
+
+#include "Server.hpp"
+
+TimeoutWheel::TimeoutWheel(asio::io_context& ioContext, Clock::duration resolution)
+    : strand_(ioContext.get_executor())
+    , timer_(strand_)
+    , resolution_(resolution)
+{
+}
+
+void TimeoutWheel::start()
+{
+    asio::dispatch(strand_, [this]() {
+        currentTime_ = Clock::now();
+        timer_.expires_at(currentTime_);
+        scheduleTick();
+    });
+}
+
+void TimeoutWheel::add(std::weak_ptr<ConnectionBase> connection)
+{
+    asio::post(strand_, [this, connection = std::move(connection)]() mutable {
+        // The connection was just started, so its deadline is at least one tick away
+        insert(std::move(connection), currentTime_ + resolution_);
+    });
+}
+
+void TimeoutWheel::scheduleTick()
+{
+    // Ticks are relative to the last expiry, so they don't drift and catch up if we fall behind
+    timer_.expires_at(timer_.expiry() + resolution_);
+    timer_.async_wait([this](const error_code& error) {
+        if (!error) {
+            tick();
+            scheduleTick();
+        }
+    });
+}
+
+void TimeoutWheel::tick()
+{
+    currentSlot_ = (currentSlot_ + 1) % numSlots;
+    currentTime_ += resolution_;
+
+    const auto now = Clock::now();
+    std::swap(due_, slots_[currentSlot_]);
+    for (auto& entry : due_) {
+        const auto connection = entry.lock();
+        if (!connection)
+            continue;
+        const auto deadline = connection->checkTimeout(now);
+        if (deadline)
+            insert(std::move(entry), *deadline);
+    }
+    due_.clear();
+}
+
+void TimeoutWheel::insert(std::weak_ptr<ConnectionBase> connection, Clock::time_point deadline)
+{
+    const auto remaining = deadline > currentTime_ ? deadline - currentTime_ : Clock::duration(0);
+    // Round up, so a connection is not checked before its deadline. If it is more than one
+    // revolution away, it is checked early and simply inserted again.
+    const auto ticks = remaining / resolution_ + (remaining % resolution_ > Clock::duration(0));
+    const auto offset = static_cast<size_t>(std::clamp<Clock::rep>(ticks, 1, numSlots - 1));
+    slots_[(currentSlot_ + offset) % numSlots].push_back(std::move(connection));
+}
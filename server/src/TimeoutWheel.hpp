@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+namespace asio = boost::asio;
+
+class ConnectionBase;
+
+// Closes connections that did not receive anything or did not complete a frame in time (see
+// ConnectionBase::checkTimeout).
+// This is a hashed timing wheel: every connection sits in the slot of its deadline and a tick only
+// looks at a single slot, so it costs O(1) per connection in it, instead of one timer per socket.
+// Connections don't touch the wheel when they receive something, they only move to the slot of
+// their new deadline when their old slot comes up. Deadlines further away than a whole revolution
+// are checked again after one revolution.
+class TimeoutWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TimeoutWheel(asio::io_context& ioContext, Clock::duration resolution);
+
+    void start();
+
+    // Thread-safe
+    void add(std::weak_ptr<ConnectionBase> connection);
+
+private:
+    static constexpr size_t numSlots = 512;
+
+    using Slot = std::vector<std::weak_ptr<ConnectionBase>>;
+
+    void scheduleTick();
+    void tick();
+    void insert(std::weak_ptr<ConnectionBase> connection, Clock::time_point deadline);
+
+    // All members are only accessed from the strand
+    asio::strand<asio::io_context::executor_type> strand_;
+    asio::steady_timer timer_;
+    Clock::duration resolution_;
+    std::array<Slot, numSlots> slots_;
+    Slot due_; // reused for the slot that is processed in tick
+    size_t currentSlot_ = 0;
+    Clock::time_point currentTime_; // the time currentSlot_ corresponds to
+};
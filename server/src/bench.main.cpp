@@ -0,0 +1,173 @@
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include "LobbyMessages.hpp"
+#include "LobbyNameAllocator.hpp"
+#include "LobbyRegistry.hpp"
+#include "util.hpp"
+
+// Microbenchmarks for the hot paths of the server. Every benchmark runs the current code next to
+// the code it replaced, so the numbers can be compared on the same machine.
+
+// The registry only stores weak_ptrs to lobbies, so they don't have to be real ones here
+struct Lobby { };
+
+template <typename Func>
+void measure(const char* name, size_t iterations, Func&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        func(i);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    std::printf("%-40s %8.1f ns\n", name, ns / iterations);
+}
+
+// The registry before LobbyKey: names were lower cased into a std::string, which was copied once
+// more for the lookup.
+class StringLobbyRegistry {
+public:
+    void insert(std::string_view name, std::weak_ptr<Lobby> lobby)
+    {
+        const auto key = boost::algorithm::to_lower_copy(std::string(name));
+        auto& shard = getShard(key);
+        std::unique_lock lock(shard.mutex);
+        shard.lobbies.emplace(key, std::move(lobby));
+    }
+
+    std::shared_ptr<Lobby> find(std::string_view name) const
+    {
+        const auto key = boost::algorithm::to_lower_copy(std::string(name));
+        const auto& shard = getShard(key);
+        std::shared_lock lock(shard.mutex);
+        const auto it = shard.lobbies.find(std::string(key));
+        return it != shard.lobbies.end() ? it->second.lock() : nullptr;
+    }
+
+private:
+    static constexpr size_t numShards = 64;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::weak_ptr<Lobby>> lobbies;
+    };
+
+    const Shard& getShard(std::string_view key) const
+    {
+        return shards_[std::hash<std::string_view>()(key) % numShards];
+    }
+
+    Shard& getShard(std::string_view key)
+    {
+        return shards_[std::hash<std::string_view>()(key) % numShards];
+    }
+
+    std::array<Shard, numShards> shards_;
+};
+
+// Finds lobbies by names with changed case in registries with numLobbies entries
+void benchRegistry(size_t numLobbies)
+{
+    LobbyNameAllocator names;
+    LobbyRegistry registry;
+    StringLobbyRegistry stringRegistry;
+    std::vector<std::shared_ptr<Lobby>> lobbies;
+    std::vector<std::string> lookups;
+    for (size_t i = 0; i < numLobbies; ++i) {
+        const auto name = LobbyNameAllocator::getName(*names.allocate());
+        lobbies.push_back(registry.insertIfAbsent(name, [] { return std::make_shared<Lobby>(); }));
+        stringRegistry.insert(name, lobbies.back());
+        auto lookup = name;
+        for (auto& c : lookup)
+            c = randInt(0, 1) ? static_cast<char>(std::toupper(c)) : c;
+        lookups.push_back(std::move(lookup));
+    }
+
+    constexpr size_t numLookups = 2'000'000;
+    // Random order, so it's not just walking the cache
+    std::vector<size_t> order(numLookups);
+    for (auto& index : order)
+        index = randInt<size_t>(0, numLobbies - 1);
+
+    std::printf("registry with %zu lobbies:\n", numLobbies);
+    size_t found = 0;
+    measure("  find (std::string + to_lower_copy)", numLookups,
+        [&](size_t i) { found += stringRegistry.find(lookups[order[i]]) != nullptr; });
+    measure("  find (LobbyKey)", numLookups,
+        [&](size_t i) { found += registry.find(lookups[order[i]]) != nullptr; });
+    if (found != 2 * numLookups)
+        std::printf("  lookups failed!\n");
+}
+
+// Decodes joinLobbyByHandle messages with the given player name
+void benchDecodeJoinLobbyByHandle(std::string_view playerName)
+{
+    BufferWriter wbuf;
+    wbuf.integer<uint8_t>(static_cast<uint8_t>(MessageType::joinLobbyByHandle));
+    wbuf.string(playerName);
+    wbuf.integer<uint32_t>(0x12345678);
+    const auto frame = wbuf.finishFrame();
+    // Without the length prefix, like the frames returned by RecvBuffer
+    const auto message = frame.buffer + sizeof(uint32_t);
+
+    constexpr size_t numDecodes = 20'000'000;
+    std::printf("decode joinLobbyByHandle (%zu byte name):\n", playerName.size());
+    size_t sink = 0;
+    // Before the schema every process function read its fields by hand, without any checks
+    measure("  hand-written", numDecodes, [&](size_t) {
+        BufferReader rbuf(message);
+        rbuf.integer<uint8_t>();
+        const auto name = rbuf.string();
+        const auto handle = rbuf.integer<uint32_t>();
+        sink += name.size() + handle;
+    });
+    measure("  decodeMessage", numDecodes, [&](size_t) {
+        BufferReader rbuf(message);
+        rbuf.integer<uint8_t>();
+        const auto msg = decodeMessage<JoinLobbyByHandleMessage>(rbuf);
+        sink += msg->playerName.size() + msg->handle;
+    });
+    if (sink != 2 * numDecodes * (playerName.size() + 0x12345678))
+        std::printf("  decoding failed!\n");
+}
+
+void benchEncodeRelayHeader()
+{
+    constexpr size_t numEncodes = 10'000'000;
+    constexpr uint16_t payloadSize = 100;
+    std::printf("encode relayMessage header:\n");
+    size_t sink = 0;
+    measure("  hand-written", numEncodes, [&](size_t i) {
+        BufferWriter wbuf(sizeof(uint8_t) * 2 + sizeof(uint16_t));
+        wbuf.integer<uint8_t>(static_cast<uint8_t>(MessageType::relayMessage));
+        wbuf.integer<uint8_t>(static_cast<uint8_t>(i));
+        wbuf.integer<uint16_t>(payloadSize);
+        sink += wbuf.finishFrame(payloadSize).buffer.size();
+    });
+    measure("  encodeMessage", numEncodes, [&](size_t i) {
+        const auto header = encodeMessage(
+            RelayMessageHeader { static_cast<uint8_t>(i), payloadSize }, payloadSize);
+        sink += header.buffer.size();
+    });
+    if (sink != 2 * numEncodes * 8)
+        std::printf("  encoding failed!\n");
+}
+
+int main()
+{
+    benchRegistry(1'000);
+    benchRegistry(1'000'000);
+    benchDecodeJoinLobbyByHandle("alice");
+    benchDecodeJoinLobbyByHandle("SomebodyWithAVeryLongName");
+    benchEncodeRelayHeader();
+    return 0;
+}
@@ -1,12 +1,16 @@
 #pragma once
 
-#include <optional>
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include <string_view>
 
 #include <boost/asio.hpp>
 
 #include <arpa/inet.h>
 
+#include "SendBuffer.hpp"
+
 namespace asio = boost::asio;
 
 template <typename T>
@@ -43,20 +47,8 @@ T hton(T val)
     return val;
 }
 
-template <typename T>
-T peekInteger(const asio::streambuf& sbuf)
-{
-    assert(sbuf.size() >= sizeof(T));
-    const auto buffer = asio::buffer_cast<const char*>(sbuf.data());
-    T val { 0 };
-    std::memcpy(&val, buffer, sizeof(T));
-    return val;
-}
-
-std::string readString(asio::streambuf& sbuf, size_t n);
-
-std::optional<std::string> readMessage(asio::streambuf& readBuf);
-
+// Reads without any bounds checks. Received messages are validated by decodeMessage (see
+// MessageSchema.hpp) before their fields are read.
 class BufferReader {
 public:
     BufferReader(asio::const_buffer buffer)
@@ -120,25 +112,43 @@ public:
         return string(size);
     }
 
+    // The view points into the underlying buffer, so it is only valid as long as that is
+    std::string_view stringView(size_t size)
+    {
+        std::string_view str(tellPtr<char>(), size);
+        seekRel(size);
+        return str;
+    }
+
+    template <typename SizeType = uint8_t>
+    std::string_view stringView()
+    {
+        const auto size = integer<SizeType>();
+        return stringView(size);
+    }
+
 private:
     asio::const_buffer buffer_;
     size_t cursor_ = 0;
 };
 
+// Encodes a single length-prefixed frame straight into SendStorage. The length prefix is reserved
+// up front and filled in by finishFrame, so the frame can be sent without copying it.
 class BufferWriter {
 public:
-    BufferWriter(size_t size = 0)
-        : buffer_(size)
+    // sizeHint is the expected size of the message (without the length prefix). If it is big
+    // enough, the storage never has to grow while writing.
+    BufferWriter(size_t sizeHint = 0)
+        : storage_(SendStorage::allocate(sizeof(uint32_t) + sizeHint))
+        , size_(sizeof(uint32_t))
     {
     }
 
     template <typename T>
     BufferWriter& integer(T val)
     {
-        std::vector<uint8_t> temp(sizeof(T));
         const T valOrdered = hton(val);
-        std::memcpy(temp.data(), &valOrdered, sizeof(T));
-        buffer_.insert(buffer_.end(), temp.begin(), temp.end());
+        std::memcpy(append(sizeof(T)), &valOrdered, sizeof(T));
         return *this;
     }
 
@@ -146,7 +156,7 @@ public:
     BufferWriter& string(std::string_view str, size_t len)
     {
         integer<SizeType>(len);
-        buffer_.insert(buffer_.end(), str.begin(), str.end());
+        std::memcpy(append(str.size()), str.data(), str.size());
         return *this;
     }
 
@@ -156,16 +166,39 @@ public:
         return string<SizeType>(str, str.size());
     }
 
-    std::string toString() const
+    // The message written so far (without the length prefix)
+    std::string_view view() const
     {
-        return std::string(buffer_.begin(), buffer_.end());
+        return std::string_view(storage_.data.get() + sizeof(uint32_t), size_ - sizeof(uint32_t));
     }
 
-    void clear()
+    // Fills in the length prefix and hands over the storage, so the writer must not be used
+    // afterwards. trailingBytes are sent right after this buffer as part of the same frame (e.g. a
+    // payload that is queued as a separate buffer).
+    SendBuffer finishFrame(size_t trailingBytes = 0)
     {
-        buffer_.clear();
+        const auto frameSize = static_cast<uint32_t>(size_ - sizeof(uint32_t) + trailingBytes);
+        const auto frameSizeOrdered = hton(frameSize);
+        std::memcpy(storage_.data.get(), &frameSizeOrdered, sizeof(uint32_t));
+        const auto buffer = asio::buffer(storage_.data.get(), size_);
+        return SendBuffer { std::move(storage_.data), buffer };
+    }
+
+    // Returns a pointer to n uninitialized bytes at the end, e.g. to write a block of fixed size
+    // fields in one go
+    char* append(size_t n)
+    {
+        if (size_ + n > storage_.capacity) {
+            auto storage = SendStorage::allocate(std::max(size_ + n, storage_.capacity * 2));
+            std::memcpy(storage.data.get(), storage_.data.get(), size_);
+            storage_ = std::move(storage);
+        }
+        const auto ptr = storage_.data.get() + size_;
+        size_ += n;
+        return ptr;
     }
 
 private:
-    std::vector<uint8_t> buffer_;
-};
\ No newline at end of file
+    SendStorage storage_;
+    size_t size_;
+};
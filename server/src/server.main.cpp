@@ -27,6 +27,17 @@ int main(int argc, char** argv)
     const Config& config = *optConfig;
     spdlog::info("Loaded config file '{}'", configPath);
 
+    if (config.ioBackend && *config.ioBackend != ioBackend) {
+        spdlog::critical("Config requests I/O backend '{}', but the server was built for '{}'. "
+                         "Rebuild with -DUSE_IO_URING={}.",
+            *config.ioBackend, ioBackend, *config.ioBackend == "io_uring" ? "ON" : "OFF");
+        return 1;
+    }
+    if (ioBackend == "io_uring")
+        spdlog::warn("The io_uring backend is experimental and has not been load tested yet");
+    if (config.heartbeatTimeout == 0)
+        spdlog::info("Idle connections are not closed, because 'heartbeatTimeout' is 0");
+
     Server<LobbySession, LobbyContext> server { config };
     server.run();
 
@@ -2,21 +2,17 @@
 
 #include <thread>
 
-// Only use this function for ASCII!
-std::string toLower(std::string_view str)
-{
-    std::string lower { str };
-    boost::algorithm::to_lower_copy(lower);
-    return lower;
-}
-
 std::string hexDump(std::string_view data)
 {
-    std::stringstream ss;
-    for (const auto& c : data) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(c) << " ";
+    // Every byte becomes two digits and a space, written straight into the result
+    constexpr char digits[] = "0123456789abcdef";
+    std::string str(data.size() * 3, ' ');
+    for (size_t i = 0; i < data.size(); ++i) {
+        const auto byte = static_cast<uint8_t>(data[i]);
+        str[i * 3] = digits[byte >> 4];
+        str[i * 3 + 1] = digits[byte & 0xf];
     }
-    return ss.str();
+    return str;
 }
 
 std::string threadIdStr()
@@ -1,12 +1,9 @@
 #include <algorithm>
-#include <iomanip>
 #include <random>
 #include <sstream>
 #include <string>
 #include <string_view>
 
-#include <boost/algorithm/string.hpp>
-
 template <typename T>
 T randInt(T min, T max)
 {
@@ -27,9 +24,6 @@ auto randomChoice(const Container& container)
     return *it;
 }
 
-// Only use this function for ASCII!
-std::string toLower(std::string_view str);
-
 std::string hexDump(std::string_view data);
 
 std::string threadIdStr();
\ No newline at end of file
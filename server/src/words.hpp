@@ -1,8 +1,2579 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <string_view>
+
+// Every combination of an adjective and a noun is a different lobby name (even ignoring case), so
+// the lists must not contain duplicates.
 
 // clang-format off
-extern const std::vector<std::string> adjectives;
-extern const std::vector<std::string> nouns;
\ No newline at end of file
+inline constexpr std::string_view adjectives[] {
+    // from here: https://github.com/Qartar/dwarf-fortress/blob/legacy/raw/objects/language_words.txt
+    // license: https://github.com/Qartar/dwarf-fortress/blob/legacy/raw/readme.txt
+    "Ace",
+    "Ageless",
+    "Ancient",
+    "Angelic",
+    "Angry",
+    "Armored",
+    "Artificial",
+    "Ashen",
+    "Autumnal",
+    "Awe",
+    "Bad",
+    "Bald",
+    "Big",
+    "Black",
+    "Blind",
+    "Bloated",
+    "Bloody",
+    "Blue",
+    "Bold",
+    "Bridled",
+    "Bright",
+    "Brilliant",
+    "Busy",
+    "Buttery",
+    "Clear",
+    "Cold",
+    "Crazed",
+    "Crazy",
+    "Creamy",
+    "Creepy",
+    "Cross",
+    "Crystalline",
+    "Dank",
+    "Dark",
+    "Dead",
+    "Dear",
+    "Deep",
+    "Domestic",
+    "Doomed",
+    "Dutiful",
+    "East",
+    "Eerie",
+    "Elder",
+    "Eternal",
+    "Everlasting",
+    "Everseeing",
+    "Evil",
+    "False",
+    "Fat",
+    "Fatal",
+    "Fetid",
+    "Fierce",
+    "Fiery",
+    "First",
+    "Fleshy",
+    "Flowery",
+    "Foggy",
+    "Foolish",
+    "Fragile",
+    "Free",
+    "Frilly",
+    "Fruity",
+    "Garish",
+    "Gaunt",
+    "Geared",
+    "Girdled",
+    "Gloved",
+    "Godly",
+    "God",
+    "Golden",
+    "Grand",
+    "Great",
+    "Green",
+    "Grim",
+    "Gristly",
+    "Grizzly",
+    "Hairy",
+    "Handy",
+    "Hateful",
+    "Hellish",
+    "Helmed",
+    "Heroic",
+    "Hideous",
+    "High",
+    "Hoary",
+    "Holy",
+    "Hungry",
+    "Icy",
+    "Idle",
+    "Ill",
+    "Impure",
+    "Inky",
+    "Invisible",
+    "Jaundiced",
+    "Just",
+    "Kind",
+    "Lacy",
+    "Lardy",
+    "Larval",
+    "Last",
+    "Lazy",
+    "Leafy",
+    "Leaky",
+    "Lean",
+    "Legendary",
+    "Light",
+    "Lone",
+    "Long",
+    "Lost",
+    "Lovely",
+    "Low",
+    "Lurid",
+    "Lush",
+    "Lustful",
+    "Lyrical",
+    "Magical",
+    "Mangy",
+    "Mellow",
+    "Mighty",
+    "Mindful",
+    "Misty",
+    "Molten",
+    "Mousy",
+    "Muddy",
+    "Musical",
+    "Mysterious",
+    "Mythical",
+    "Nasty",
+    "Natural",
+    "Negative",
+    "New",
+    "Noble",
+    "North",
+    "Null",
+    "Oaken",
+    "Oceanic",
+    "Old",
+    "Padded",
+    "Painful",
+    "Pale",
+    "Peaceful",
+    "Poisoned",
+    "Pregnant",
+    "Prim",
+    "Prime",
+    "Primitive",
+    "Profane",
+    "Pulpy",
+    "Purple",
+    "Putrid",
+    "Quick",
+    "Rainy",
+    "Random",
+    "Raw",
+    "Red",
+    "Regal",
+    "Ripe",
+    "Romantic",
+    "Roomy",
+    "Rosy",
+    "Rough",
+    "Royal",
+    "Ruined",
+    "Rumored",
+    "Salty",
+    "Satiny",
+    "Savage",
+    "Scabrous",
+    "Secretive",
+    "Sick",
+    "Silent",
+    "Silken",
+    "Silky",
+    "Silty",
+    "Silvery",
+    "Sinful",
+    "Slim",
+    "Slitted",
+    "Smooth",
+    "Sooty",
+    "South",
+    "Spicy",
+    "Spidery",
+    "Spry",
+    "Stern",
+    "Sticky",
+    "Stormy",
+    "Strange",
+    "Strapping",
+    "Strong",
+    "Stunted",
+    "Stupid",
+    "Subordinate",
+    "Sugary",
+    "Sullen",
+    "Sunny",
+    "Sweet",
+    "Swift",
+    "Terrible",
+    "Tight",
+    "Touchy",
+    "Trim",
+    "Ugly",
+    "Ultimate",
+    "Unbridled",
+    "Ungodly",
+    "Unholy",
+    "Unkempt",
+    "Unseen",
+    "Untoward",
+    "Unwelcome",
+    "Useless",
+    "Velvety",
+    "Vile",
+    "Violent",
+    "Violet",
+    "Watchful",
+    "Wavy",
+    "West",
+    "White",
+    "Wicked",
+    "Wild",
+    "Willful",
+    "Wispy",
+    "Wondrous",
+    "Wooden",
+    "Wretched",
+    "Yellow",
+    "Young",
+    "Youthful",
+    "Earthen",
+    "Common",
+    "Diamond",
+    "Dreamy",
+    "Tin",
+    "Copper",
+    "Bronze",
+    "Granite",
+    "Fancy",
+    "Frothy",
+    "Glacial",
+    "Jade",
+    "Ivory",
+    "Limp",
+    "Lucid",
+    "Mountainous",
+    "Mucous",
+    "Patterned",
+    "Plain",
+    "Pointy",
+    "Speckled",
+    "Wealthy",
+    "Whimsical",
+    "Whirling",
+    "Livid",
+    "Tepid",
+    "Honest",
+    "Imperial",
+    "Simple",
+    "Crimson",
+    "Subtle",
+    "Amazing",
+    "Alchemical",
+    "Insightful",
+    "Persuasive",
+    "Basic",
+    "Systemic",
+    "Clean",
+    "Glorious",
+    "Dismal",
+    "Radiant",
+    "Messianic",
+    "Laborious",
+    "Chunky",
+    "Slippery",
+    "Single",
+    "Permanent",
+    "Responsible",
+    "Constructive",
+    "Gross",
+    "Gnarled",
+    "Naughty",
+    "Playful",
+    "Flimsy",
+    "Greater",
+    "Greatest",
+    "Lesser",
+    "Least",
+    "Bearded",
+    "Dreadful",
+    "Walled",
+    "Fragrant",
+    "Lined",
+    "Waxy",
+    "Glittery",
+    "Hollow",
+    "Full",
+    "Empty",
+    "Wordy",
+    "Intense",
+    "Sad",
+    "Glad",
+    "Tragic",
+    "Ponderous",
+    "Heavenly",
+    "Round",
+    "Rounded",
+    "Unspeakable",
+    "Unthinkable",
+    "Unnameable",
+    "Calamitous",
+    "Cyclopean",
+    "Tame",
+    "Untamed",
+    "Trite",
+    "Trifling",
+    "Rank",
+    "Rancorous",
+    "Bitter",
+    "Sour",
+    "Dangerous",
+    "Impervious",
+    "Unswerving",
+    "Luxurious",
+    "Euphoric",
+    "Scintillating",
+    "Divine",
+    "Tainted",
+    "Corrupt",
+    "Maligned",
+    "Malign",
+    "Malignant",
+    "Trustworthy",
+    "Untrustworthy",
+    "Dishonest",
+    "Blighted",
+    "Cunning",
+    "Sly",
+    "Rustic",
+    "Homely",
+    "Lonely",
+    "Lonesome",
+    "Closed",
+    "Wayward",
+    "Monstrous",
+    "Sensitive",
+    "Insensitive",
+    "Sensual",
+    "Odorous",
+    "Malodorous",
+    "Ignorant",
+    "Ignoble",
+    "Humble",
+    "Moral",
+    "Immoral",
+    "Superior",
+    "Inferior",
+    "Infinite",
+    "Sable",
+    "Fell",
+    "Dignified",
+    "Undignified",
+    "Righteous",
+    "Absolute",
+    "Fair",
+    "Snarling",
+    "Loyal",
+    "Disloyal",
+    "Helpful",
+    "Friendly",
+    "Courteous",
+    "Cheerful",
+    "Thrifty",
+    "Brave",
+    "Revered",
+    "Venerable",
+    "National",
+    "Considerate",
+    "Convenient",
+    "Inconsiderate",
+    "Inconvenient",
+    "Flighty",
+    "Gilded",
+    "Plaited",
+    "Braided",
+    "Pleated",
+    "Folded",
+    "Uncommon",
+    "Rare",
+    "Scarce",
+    "Remarkable",
+    "Unremarkable",
+    "Solitary",
+    "Bent",
+    "Blameless",
+    "Trussed",
+    "Skewered",
+    "Sculpted",
+    "Tressed",
+    "Curled",
+    "Tufted",
+    "Mean",
+    "Shameful",
+    "Ashamed",
+    "Steamy",
+    "Worried",
+    "Blanketed",
+    "Cloudy",
+    "Plated",
+    "Sorcerous",
+    "Bewitched",
+    "Enchanted",
+    "Stinky",
+    "Windy",
+    "Hazy",
+    "Torturous",
+    "Scholarly",
+    "Massive",
+    "Large",
+    "Small",
+    "Tiled",
+    "Stale",
+    "Fresh",
+    "Worthy",
+    "Worthless",
+    "Frightful",
+    "Revolting",
+    "Disgusting",
+    "Outrageous",
+    "Cruel",
+    "Deviant",
+    "Devious",
+    "Fabulous",
+    "Skinny",
+    "Narrow",
+    "Grieving",
+    "Belted",
+    "Sandaled",
+    "Future",
+    "Past",
+    "Present",
+    "Split",
+    "Brash",
+    "Brazen",
+    "Strangled",
+    "Muscular",
+    "Dim",
+    "Spurting",
+    "Risky",
+    "Mirthful",
+    "Gleeful",
+    "Drab",
+    "Oracular",
+    "Decisive",
+    "Special",
+    "Portentous",
+    "Momentous",
+    "Infallible",
+    "Ambiguous",
+    "Curious",
+    "Obscure",
+    "Obscene",
+    "Vulgar",
+    "Ominous",
+    "Occult",
+    "Ordered",
+    "Faithful",
+    "Guilty",
+    "Girlish",
+    "Boyish",
+    "Slick",
+    "Still",
+    "Calm",
+    "Laconic",
+    "Mute",
+    "Noiseless",
+    "Quiescent",
+    "Quiet",
+    "Reticent",
+    "Saturnine",
+    "Speechless",
+    "Taciturn",
+    "Fortunate",
+    "Accidental",
+    "Circumstantial",
+    "Contingent",
+    "Coincidental",
+    "Lucky",
+    "Certain",
+    "Uncertain",
+    "Fortuitous",
+    "Incidental",
+    "Amusing",
+    "Distracting",
+    "Competitive",
+    "Contested",
+    "Matched",
+    "Strategic",
+    "Tactical",
+    "Autonomous",
+    "Emancipated",
+    "Released",
+    "Relieved",
+    "Even",
+    "Balanced",
+    "Equivalent",
+    "Static",
+    "Symmetric",
+    "Equal",
+    "Harmonious",
+    "Neutral",
+    "Stable",
+    "Dour",
+    "Gloomy",
+    "Severe",
+    "Glum",
+    "Hot",
+    "Cavernous",
+    "Shady",
+    "Veiled",
+    "Umbral",
+    "Murky",
+    "Faint",
+    "Somber",
+    "Tenebrous",
+    "Morose",
+    "Beloved",
+    "Escorted",
+    "Pungent",
+    "Musty",
+    "Infected",
+    "Afflicted",
+    "Aching",
+    "Epidemic",
+    "Yawning",
+    "Assaulted",
+    "Carnal",
+    "Strifeful",
+    "Safe",
+    "Flayed",
+    "Oily",
+    "Suicidal",
+    "Tempted",
+    "Contemptible",
+    "Sacrificial",
+    "Trampled",
+    "Malicious",
+    "Spiteful",
+    "Coastal",
+    "Brutal",
+    "Harsh",
+    "Pristine",
+    "Ferocious",
+    "Barbarous",
+    "Feral",
+    "Furious",
+    "Ruthless",
+    "Gory",
+    "Virtuous",
+    "Scandalous",
+    "Climactic",
+    "Crested",
+    "Most",
+    "Blunt",
+    "Frosty",
+    "Feverish",
+    "Humid",
+    "Humorous",
+    "Comedic",
+    "Sizzling",
+    "Sweltering",
+    "Warm",
+    "Torrid",
+    "Acrid",
+    "Craterous",
+    "Dented",
+    "Depressed",
+    "Dimpled",
+    "Dipped",
+    "Excavated",
+    "Grooved",
+    "Distant",
+    "Notched",
+    "Sagging",
+    "Socketed",
+    "Fenced",
+    "Barricaded",
+    "Blockaded",
+    "Defended",
+    "Defensive",
+    "Abyssal",
+    "Abysmal",
+    "Submerged",
+    "Hale",
+    "Robust",
+    "Hardy",
+    "Vigorous",
+    "Dabbling",
+    "Doused",
+    "Drenched",
+    "Moist",
+    "Sloppy",
+    "Soaked",
+    "Spattered",
+    "Splattered",
+    "Sprayed",
+    "Spread",
+    "Twinkling",
+    "Wet",
+    "Faded",
+    "Colorless",
+    "Dull",
+    "Evaporated",
+    "Lustrous",
+    "Vanished",
+    "Washed",
+    "Abated",
+    "Declining",
+    "Deteriorated",
+    "Diminished",
+    "Dispersed",
+    "Droopy",
+    "Dwindling",
+    "Kindled",
+    "Stoked",
+    "Stirred",
+    "Fed",
+    "Failed",
+    "Languishing",
+    "Lessened",
+    "Shriveled",
+    "Sunken",
+    "Tapered",
+    "Thin",
+    "Tired",
+    "Waning",
+    "Weak",
+    "Wilted",
+    "Withered",
+    "Honorable",
+    "Adorable",
+    "Celebrated",
+    "Confident",
+    "Deferent",
+    "Distinct",
+    "Elevated",
+    "Esteemed",
+    "Exalted",
+    "Famous",
+    "Mortal",
+    "Immortal",
+    "Lauded",
+    "Obeisant",
+    "Praised",
+    "Prestigious",
+    "Renowned",
+    "Reputed",
+    "Worshipful",
+    "Chaste",
+    "Courageous",
+    "Decent",
+    "Good",
+    "Innocent",
+    "Modest",
+    "Pure",
+    "True",
+    "Truthful",
+    "Virginal",
+    "Held",
+    "Scalded",
+    "Scaly",
+    "Labyrinthine",
+    "Crowded",
+    "Familial",
+    "Organized",
+    "Tangled",
+    "Entangled",
+    "Puzzling",
+    "Perplexing",
+    "Combined",
+    "Flickering",
+    "Branded",
+    "Singed",
+    "Searing",
+    "Scorching",
+    "Roasted",
+    "Parched",
+    "Ignited",
+    "Incinerated",
+    "Glowing",
+    "Cremated",
+    "Factional",
+    "Crewed",
+    "Cooperative",
+    "Routed",
+    "Scraped",
+    "Scoured",
+    "Scrubbed",
+    "Shaken",
+    "Soapy",
+    "Spongy",
+    "Whiskered",
+    "Dominant",
+    "Grasping",
+    "Influential",
+    "Tenacious",
+    "Confining",
+    "Contained",
+    "Cradled",
+    "Embraced",
+    "Circular",
+    "Square",
+    "Triangular",
+    "Connected",
+    "Merged",
+    "Confusing",
+    "Complex",
+    "Meandering",
+    "Muddled",
+    "Bewildering",
+    "Problematic",
+    "Intricate",
+    "Polished",
+    "Purged",
+    "Banded",
+    "Tall",
+    "Short",
+    "Bulbous",
+    "Allied",
+    "Enjoyable",
+    "Fondled",
+    "Imprisoned",
+    "Nourishing",
+    "Squeezing",
+    "Defective",
+    "Perfect",
+    "Bejeweled",
+    "Blotted",
+    "Blowing",
+    "Brushed",
+    "Erased",
+    "Tender",
+    "Mechanical",
+    "Smeared",
+    "Tattooed",
+    "Weathered",
+    "Entrancing",
+    "Delightful",
+    "Joyous",
+    "Frigid",
+    "Passionate",
+    "Ardent",
+    "Boring",
+    "Flecked",
+    "Spotted",
+    "Creative",
+    "Poetic",
+    "Hermitic",
+    "Reclusive",
+    "Named",
+    "Rhyming",
+    "Rhythmic",
+    "Squashed",
+    "Habitual",
+    "Disemboweled",
+    "Eviscerated",
+    "Rapid",
+    "Healing",
+    "Slow",
+    "Mired",
+    "Admired",
+    "Lamented",
+    "Adventurous",
+    "Mournful",
+    "Anguished",
+    "Taut",
+    "Deified",
+    "Infamous",
+    "Mortified",
+    "Riddled",
+    "Amber",
+    "Amethyst",
+    "Aqua",
+    "Aquamarine",
+    "Gray",
+    "Auburn",
+    "Azure",
+    "Beige",
+    "Brass",
+    "Brown",
+    "Buff",
+    "Sienna",
+    "Umber",
+    "Cardinal",
+    "Carmine",
+    "Cerulean",
+    "Charcoal",
+    "Chartreuse",
+    "Chestnut",
+    "Chocolate",
+    "Cinnamon",
+    "Cobalt",
+    "Indigo",
+    "Olive",
+    "Pink",
+    "Scarlet",
+    "Tan",
+    "Ecru",
+    "Emerald",
+    "Flaxen",
+    "Fuchsia",
+    "Goldenrod",
+    "Heliotrope",
+    "Lavender",
+    "Mahogany",
+    "Maroon",
+    "Mauve",
+    "Taupe",
+    "Mint",
+    "Ochre",
+    "Puce",
+    "Russet",
+    "Saffron",
+    "Sepia",
+    "Teal",
+    "Turquoise",
+    "Vermilion",
+    "Fated",
+    "Destined",
+    "Little",
+    "Early",
+    "Late",
+    "Living",
+    "Hopeful",
+    "Beautiful",
+    "Respectful",
+    "Heavy",
+    "Born",
+    "Learned",
+    "Mischievous",
+    "Wise",
+    "Knowing",
+    "Cracked",
+    "Shattered",
+    "Squat",
+    "Festive",
+};
+
+inline constexpr std::string_view nouns[] {
+    // from here: https://github.com/Qartar/dwarf-fortress/blob/legacy/raw/objects/language_words.txt
+    // license: https://github.com/Qartar/dwarf-fortress/blob/legacy/raw/readme.txt
+    "Abbey",
+    "Ace",
+    "Act",
+    "Age",
+    "Ale",
+    "Ancient",
+    "Angel",
+    "Anger",
+    "Animal",
+    "Ape",
+    "Apple",
+    "Arm",
+    "Armor",
+    "Arrow",
+    "Artifice",
+    "Ash",
+    "Aunt",
+    "Aura",
+    "Autumn",
+    "Axe",
+    "Back",
+    "Baldness",
+    "Baker",
+    "Ball",
+    "Bane",
+    "Bar",
+    "Barb",
+    "Bath",
+    "Battle",
+    "Beak",
+    "Beast",
+    "Bear",
+    "Bee",
+    "Beer",
+    "Beetle",
+    "Beguiler",
+    "Belch",
+    "Berry",
+    "Bile",
+    "Bin",
+    "Bird",
+    "Blackness",
+    "Blade",
+    "Blaze",
+    "Blindness",
+    "Blister",
+    "Bloat",
+    "Blood",
+    "Bloodiness",
+    "Blossom",
+    "Blueness",
+    "Boar",
+    "Boat",
+    "Bodice",
+    "Bog",
+    "Boil",
+    "Boldness",
+    "Bolt",
+    "Bone",
+    "Book",
+    "Boot",
+    "Bow",
+    "Brain",
+    "Breach",
+    "Breeches",
+    "Bread",
+    "Breaker",
+    "Breakfast",
+    "Breath",
+    "Breed",
+    "Brew",
+    "Bride",
+    "Bridle",
+    "Brightness",
+    "Bristle",
+    "Brilliance",
+    "Brim",
+    "Brother",
+    "Brunch",
+    "Buck",
+    "Buckle",
+    "Bunch",
+    "Burden",
+    "Burn",
+    "Burial",
+    "Bush",
+    "Bushel",
+    "Bust",
+    "Buster",
+    "Business",
+    "Butcher",
+    "Butter",
+    "Butterfly",
+    "Button",
+    "Buzzard",
+    "Cad",
+    "Cage",
+    "Cake",
+    "Call",
+    "Camp",
+    "Cancer",
+    "Candle",
+    "Candy",
+    "Canker",
+    "Canyon",
+    "Carnage",
+    "Casket",
+    "Castle",
+    "Cat",
+    "Cave",
+    "Cell",
+    "Chain",
+    "Chant",
+    "Chaos",
+    "Chamber",
+    "Charm",
+    "Child",
+    "Chill",
+    "Chip",
+    "Cinder",
+    "Clam",
+    "Clasp",
+    "Claw",
+    "Clearing",
+    "Cleft",
+    "Cloak",
+    "Clock",
+    "Clod",
+    "Cloister",
+    "Closet",
+    "Club",
+    "Cluster",
+    "Clutter",
+    "Cobra",
+    "Coil",
+    "Coldness",
+    "Color",
+    "Comet",
+    "Conqueror",
+    "Cook",
+    "Cover",
+    "Cotton",
+    "Couple",
+    "Crab",
+    "Craze",
+    "Craziness",
+    "Cream",
+    "Creek",
+    "Creep",
+    "Creepiness",
+    "Crescent",
+    "Cross",
+    "Crow",
+    "Crown",
+    "Crucifixion",
+    "Crusher",
+    "Crypt",
+    "Crystal",
+    "Cudgel",
+    "Cup",
+    "Curse",
+    "Cut",
+    "Cyst",
+    "Dance",
+    "Dankness",
+    "Dagger",
+    "Darkness",
+    "Date",
+    "Dawn",
+    "Day",
+    "Dead",
+    "Death",
+    "Decay",
+    "Deceiver",
+    "Deep",
+    "Deer",
+    "Demon",
+    "Despair",
+    "Destroyer",
+    "Destruction",
+    "Devil",
+    "Devourer",
+    "Dinner",
+    "Dirt",
+    "Ditch",
+    "Dog",
+    "Domicile",
+    "Donkey",
+    "Doom",
+    "Door",
+    "Dragon",
+    "Drain",
+    "Drawl",
+    "Dreg",
+    "Dress",
+    "Drinker",
+    "Drip",
+    "Drool",
+    "Drum",
+    "Dump",
+    "Dumpling",
+    "Dung",
+    "Dungeon",
+    "Dusk",
+    "Dust",
+    "Duty",
+    "Dye",
+    "Eagle",
+    "Ear",
+    "Eater",
+    "Eel",
+    "Eerieness",
+    "Egg",
+    "Elder",
+    "Entrails",
+    "Evil",
+    "Execution",
+    "Executioner",
+    "Eye",
+    "Face",
+    "Fall",
+    "Falsehood",
+    "Famine",
+    "Fang",
+    "Fat",
+    "Father",
+    "Fear",
+    "Feast",
+    "Fiend",
+    "Fierceness",
+    "Filth",
+    "Fin",
+    "Finder",
+    "Finger",
+    "Fire",
+    "Fish",
+    "Fisher",
+    "Fist",
+    "Flame",
+    "Flank",
+    "Flea",
+    "Flesh",
+    "Flood",
+    "Flower",
+    "Flute",
+    "Fly",
+    "Flier",
+    "Focus",
+    "Fog",
+    "Fool",
+    "Foot",
+    "Forest",
+    "Fork",
+    "Fortification",
+    "Fortress",
+    "Fragment",
+    "Frame",
+    "Freedom",
+    "Frenzy",
+    "Frill",
+    "Frog",
+    "Fruit",
+    "Fungus",
+    "Fur",
+    "Gall",
+    "Game",
+    "Garlic",
+    "Garnish",
+    "Gate",
+    "Gaze",
+    "Gear",
+    "Gerbil",
+    "Ghost",
+    "Ghoul",
+    "Gift",
+    "Gill",
+    "Girdle",
+    "Gland",
+    "Glaze",
+    "Glen",
+    "Glimmer",
+    "Gloss",
+    "Glove",
+    "Glutton",
+    "Goat",
+    "God",
+    "Gold",
+    "Goose",
+    "Gorge",
+    "Grain",
+    "Grape",
+    "Grass",
+    "Grave",
+    "Grease",
+    "Greatness",
+    "Greed",
+    "Greenness",
+    "Griffon",
+    "Grip",
+    "Gristle",
+    "Grizzle",
+    "Grove",
+    "Grower",
+    "Growl",
+    "Growth",
+    "Grub",
+    "Guard",
+    "Guile",
+    "Guise",
+    "Gut",
+    "Gutter",
+    "Hag",
+    "Hair",
+    "Hame",
+    "Hammer",
+    "Hammerer",
+    "Hand",
+    "Hare",
+    "Harvest",
+    "Harvester",
+    "Hatchet",
+    "Hate",
+    "Haunt",
+    "Hawk",
+    "Hay",
+    "Head",
+    "Heart",
+    "Hearth",
+    "Heather",
+    "Hedge",
+    "Hell",
+    "Helm",
+    "Hero",
+    "Hex",
+    "Hide",
+    "Hill",
+    "Hip",
+    "Hog",
+    "Holiness",
+    "Hole",
+    "Home",
+    "Honey",
+    "Hood",
+    "Hoof",
+    "Hop",
+    "Hopper",
+    "Horn",
+    "Horse",
+    "Hound",
+    "Howl",
+    "Hug",
+    "Hunger",
+    "Ice",
+    "Idleness",
+    "Idol",
+    "Illness",
+    "Impurity",
+    "Incense",
+    "Inch",
+    "Ink",
+    "Inn",
+    "Insanity",
+    "Iron",
+    "Itch",
+    "Ivy",
+    "Jack",
+    "Jackal",
+    "Jaundice",
+    "Jaw",
+    "Jester",
+    "Joke",
+    "Juggler",
+    "Juice",
+    "Jungle",
+    "Justice",
+    "Keeper",
+    "Keg",
+    "Key",
+    "Kindness",
+    "Killer",
+    "Kiss",
+    "King",
+    "Knife",
+    "Knight",
+    "Knot",
+    "Lace",
+    "Lake",
+    "Lard",
+    "Lark",
+    "Larva",
+    "Law",
+    "Laziness",
+    "Leader",
+    "Leaf",
+    "Leak",
+    "Leech",
+    "Legend",
+    "Lens",
+    "Leopard",
+    "Leper",
+    "Leprosy",
+    "Letter",
+    "Lie",
+    "Light",
+    "Lightning",
+    "Limb",
+    "Lip",
+    "Lizard",
+    "Lobster",
+    "Lock",
+    "Length",
+    "Loot",
+    "Lord",
+    "Louse",
+    "Love",
+    "Lowness",
+    "Lunch",
+    "Lung",
+    "Lust",
+    "Lute",
+    "Lyric",
+    "Maggot",
+    "Magic",
+    "Man",
+    "Mange",
+    "Marsh",
+    "Martyr",
+    "Master",
+    "Maw",
+    "Mead",
+    "Meadow",
+    "Meal",
+    "Meat",
+    "Meditation",
+    "Menace",
+    "Mess",
+    "Metal",
+    "Midnight",
+    "Might",
+    "Mightiness",
+    "Mile",
+    "Mind",
+    "Minion",
+    "Mirror",
+    "Misery",
+    "Mist",
+    "Mite",
+    "Mold",
+    "Mole",
+    "Monkey",
+    "Moon",
+    "Monger",
+    "Moth",
+    "Mother",
+    "Mouse",
+    "Mouth",
+    "Muck",
+    "Mud",
+    "Muffin",
+    "Mule",
+    "Murder",
+    "Mush",
+    "Mushroom",
+    "Music",
+    "Mystery",
+    "Myth",
+    "Nail",
+    "Nature",
+    "Negator",
+    "Nest",
+    "Net",
+    "Nettle",
+    "Newt",
+    "Night",
+    "Nightmare",
+    "Noble",
+    "Noose",
+    "Nose",
+    "Number",
+    "Nut",
+    "Oak",
+    "Oar",
+    "Oat",
+    "Oblivion",
+    "Ocean",
+    "Omen",
+    "One",
+    "Onion",
+    "Ooze",
+    "Orb",
+    "Owl",
+    "Ox",
+    "Pack",
+    "Pad",
+    "Page",
+    "Pain",
+    "Paint",
+    "Paleness",
+    "Palm",
+    "Panther",
+    "Pants",
+    "Paper",
+    "Peace",
+    "Peach",
+    "Pepper",
+    "Phlegm",
+    "Pig",
+    "Pit",
+    "Pitch",
+    "Plague",
+    "Plant",
+    "Planter",
+    "Plot",
+    "Pocket",
+    "Poison",
+    "Portal",
+    "Power",
+    "Prank",
+    "Pregnancy",
+    "Pride",
+    "Priest",
+    "Profanity",
+    "Prophecy",
+    "Prophet",
+    "Prowler",
+    "Puke",
+    "Pulley",
+    "Pulp",
+    "Punch",
+    "Pus",
+    "Putrescence",
+    "Quake",
+    "Queen",
+    "Quickness",
+    "Quill",
+    "Rabbit",
+    "Rabble",
+    "Race",
+    "Rack",
+    "Rag",
+    "Rage",
+    "Rain",
+    "Ram",
+    "Rampage",
+    "Raptor",
+    "Rat",
+    "Raunch",
+    "Ravager",
+    "Raven",
+    "Rawness",
+    "Razor",
+    "Redness",
+    "Reign",
+    "Rein",
+    "Rider",
+    "Rim",
+    "Ring",
+    "Rip",
+    "Ripeness",
+    "Ripper",
+    "Rite",
+    "River",
+    "Rock",
+    "Rogue",
+    "Romance",
+    "Room",
+    "Root",
+    "Rose",
+    "Rot",
+    "Roughness",
+    "Ruin",
+    "Ruler",
+    "Rumor",
+    "Rust",
+    "Sabre",
+    "Sack",
+    "Saint",
+    "Salt",
+    "Salve",
+    "Sap",
+    "Satin",
+    "Savage",
+    "Savagery",
+    "Savior",
+    "Scab",
+    "Scar",
+    "Scorpion",
+    "Scratch",
+    "Scourge",
+    "Scream",
+    "Scum",
+    "Sea",
+    "Seal",
+    "Seam",
+    "Season",
+    "Secret",
+    "Seduction",
+    "Seducer",
+    "Seed",
+    "Seer",
+    "Seizure",
+    "Serpent",
+    "Servant",
+    "Sever",
+    "Sewer",
+    "Shadow",
+    "Shaft",
+    "Shank",
+    "Shark",
+    "Sheen",
+    "Shell",
+    "Shelter",
+    "Shield",
+    "Ship",
+    "Show",
+    "Shred",
+    "Shriek",
+    "Sick",
+    "Sickness",
+    "Siege",
+    "Silence",
+    "Silk",
+    "Silkiness",
+    "Silt",
+    "Silver",
+    "Sin",
+    "Sinew",
+    "Song",
+    "Sister",
+    "Skirt",
+    "Skunk",
+    "Skull",
+    "Sky",
+    "Slaughter",
+    "Slave",
+    "Slayer",
+    "Slime",
+    "Sling",
+    "Slit",
+    "Sliver",
+    "Sloth",
+    "Slug",
+    "Smile",
+    "Smith",
+    "Smoke",
+    "Smoothness",
+    "Snack",
+    "Snake",
+    "Sneer",
+    "Snot",
+    "Soil",
+    "Soldier",
+    "Soot",
+    "Sorrow",
+    "Soul",
+    "Sound",
+    "Spasm",
+    "Spawn",
+    "Spear",
+    "Spell",
+    "Spice",
+    "Spider",
+    "Spike",
+    "Spine",
+    "Spirit",
+    "Spit",
+    "Spittle",
+    "Spoils",
+    "Spoon",
+    "Spring",
+    "Spy",
+    "Squid",
+    "Staff",
+    "Stalker",
+    "Stance",
+    "Star",
+    "Steed",
+    "Starvation",
+    "Steel",
+    "Stench",
+    "Stick",
+    "Stone",
+    "Storm",
+    "Strangeness",
+    "Strap",
+    "Straw",
+    "Stray",
+    "Strength",
+    "Strike",
+    "Stroke",
+    "Stunt",
+    "Style",
+    "Subordinate",
+    "Sucker",
+    "Suffering",
+    "Sugar",
+    "Summer",
+    "Sun",
+    "Supper",
+    "Surprise",
+    "Swamp",
+    "Sweat",
+    "Sweetness",
+    "Swine",
+    "Sword",
+    "Syrup",
+    "Taker",
+    "Tail",
+    "Talon",
+    "Tar",
+    "Tarnish",
+    "Tempest",
+    "Tear",
+    "Terror",
+    "Thief",
+    "Thirst",
+    "Thorn",
+    "Thrall",
+    "Throat",
+    "Throne",
+    "Thrower",
+    "Thunder",
+    "Tick",
+    "Tightness",
+    "Time",
+    "Toad",
+    "Toe",
+    "Tomb",
+    "Tome",
+    "Tongue",
+    "Tooth",
+    "Torment",
+    "Touch",
+    "Tour",
+    "Tower",
+    "Trail",
+    "Trance",
+    "Trap",
+    "Trash",
+    "Treasure",
+    "Treat",
+    "Treaty",
+    "Trench",
+    "Tribe",
+    "Trick",
+    "Trickery",
+    "Trim",
+    "Trouble",
+    "Tulip",
+    "Tumor",
+    "Turmoil",
+    "Tusk",
+    "Twilight",
+    "Twine",
+    "Twist",
+    "Ugliness",
+    "Ulcer",
+    "Uncle",
+    "Unholiness",
+    "Urn",
+    "Vandal",
+    "Vegetable",
+    "Vegetation",
+    "Velvet",
+    "Venom",
+    "Vermin",
+    "Vileness",
+    "Violator",
+    "Violence",
+    "Viper",
+    "Voice",
+    "Void",
+    "Volcano",
+    "Vomit",
+    "Vulture",
+    "Wail",
+    "Wanderer",
+    "War",
+    "Warrior",
+    "Wasp",
+    "Waste",
+    "Watch",
+    "Watchfulness",
+    "Wave",
+    "Waviness",
+    "Weasel",
+    "Weaver",
+    "Weed",
+    "Weight",
+    "Weird",
+    "Wheat",
+    "Wheel",
+    "Whip",
+    "Whisky",
+    "Whisper",
+    "Whiteness",
+    "Wickedness",
+    "Wildness",
+    "Will",
+    "Wing",
+    "Winter",
+    "Wisp",
+    "Witch",
+    "Wonder",
+    "Wood",
+    "Work",
+    "Worm",
+    "Wraith",
+    "Wrath",
+    "Wretch",
+    "Yarn",
+    "Year",
+    "Yearling",
+    "Yellowness",
+    "Yore",
+    "Youth",
+    "Zeal",
+    "Zealot",
+    "Zephyr",
+    "Earth",
+    "Artifact",
+    "Bed",
+    "Bud",
+    "Daub",
+    "Desert",
+    "Dessert",
+    "Diamond",
+    "Domain",
+    "Dream",
+    "Tin",
+    "Copper",
+    "Bronze",
+    "Granite",
+    "Fanciness",
+    "Farm",
+    "Field",
+    "Froth",
+    "Genius",
+    "Glacier",
+    "Jade",
+    "Ivory",
+    "Land",
+    "Lucidity",
+    "Mountain",
+    "Mucus",
+    "Pattern",
+    "Pebble",
+    "Boulder",
+    "Petal",
+    "Droplet",
+    "Pinnacle",
+    "Plain",
+    "Point",
+    "Pot",
+    "Prairie",
+    "Sleeve",
+    "Speck",
+    "Steppe",
+    "Tentacle",
+    "Test",
+    "Tub",
+    "Tube",
+    "Tundra",
+    "Wealth",
+    "Weevil",
+    "Whim",
+    "World",
+    "Pantomime",
+    "Sludge",
+    "Goo",
+    "Realm",
+    "Plane",
+    "Dimension",
+    "Universe",
+    "Planet",
+    "Honesty",
+    "Kingdom",
+    "Empire",
+    "Confederation",
+    "Simplicity",
+    "Trooper",
+    "Dune",
+    "Direction",
+    "Clash",
+    "Forever",
+    "Subtlety",
+    "Puppet",
+    "Hegemon",
+    "Amazement",
+    "Alchemy",
+    "Insight",
+    "Union",
+    "Confederacy",
+    "Speech",
+    "Speaker",
+    "Persuasion",
+    "Persuader",
+    "Control",
+    "Controller",
+    "Worker",
+    "Basis",
+    "System",
+    "Ray",
+    "Target",
+    "Bank",
+    "Glory",
+    "Radiance",
+    "Pine",
+    "Messiah",
+    "Craft",
+    "Labor",
+    "Discovery",
+    "Proliferation",
+    "Chunk",
+    "Pick",
+    "Tongs",
+    "Permanency",
+    "Responsibility",
+    "Requirement",
+    "Rooter",
+    "Blizzard",
+    "General",
+    "Memory",
+    "Construct",
+    "Lamb",
+    "Toast",
+    "Paddle",
+    "Council",
+    "Counsellor",
+    "Stump",
+    "Naughtiness",
+    "Play",
+    "Flimsiness",
+    "Beard",
+    "Dread",
+    "Wall",
+    "Tax",
+    "Fragrance",
+    "Lantern",
+    "Torch",
+    "Water",
+    "Wine",
+    "Line",
+    "Mine",
+    "Wax",
+    "Shove",
+    "Shovel",
+    "Wrack",
+    "Glitter",
+    "Spark",
+    "Sparkle",
+    "Flash",
+    "Gleam",
+    "Savant",
+    "Roar",
+    "Yell",
+    "Echo",
+    "Hollow",
+    "Emptiness",
+    "Word",
+    "Intensity",
+    "Sadness",
+    "Gladness",
+    "Tragedy",
+    "Bell",
+    "Belly",
+    "Tummy",
+    "Shock",
+    "Heaven",
+    "Calamity",
+    "Meteor",
+    "Trifle",
+    "Rancor",
+    "Bitterness",
+    "Sourness",
+    "Danger",
+    "Luxury",
+    "Euphoria",
+    "Corruption",
+    "Trust",
+    "Distrust",
+    "Blight",
+    "Ford",
+    "Way",
+    "Bandit",
+    "Brigand",
+    "Monster",
+    "Sense",
+    "Odor",
+    "Malodor",
+    "Ignorance",
+    "Humility",
+    "Moral",
+    "Fell",
+    "Pelt",
+    "Dignity",
+    "Indignation",
+    "Right",
+    "Snarl",
+    "Loyalty",
+    "Disloyalty",
+    "Help",
+    "Friend",
+    "Courtesy",
+    "Thrift",
+    "Bravery",
+    "Reverence",
+    "Veneration",
+    "Salute",
+    "Nation",
+    "Drink",
+    "Consideration",
+    "Convenience",
+    "Inconvenience",
+    "Continent",
+    "Flight",
+    "Guild",
+    "Merchant",
+    "Trade",
+    "Plait",
+    "Braid",
+    "Pleat",
+    "Fold",
+    "Bunion",
+    "Bend",
+    "Blame",
+    "Twig",
+    "Girder",
+    "Truss",
+    "Skewer",
+    "Sculpture",
+    "Tress",
+    "Curl",
+    "Tuft",
+    "Meanness",
+    "Shame",
+    "Steam",
+    "Fern",
+    "Ferry",
+    "Gully",
+    "Worry",
+    "Lion",
+    "Cactus",
+    "Desk",
+    "Bottle",
+    "Shingle",
+    "Blanket",
+    "Cloud",
+    "Plate",
+    "Road",
+    "House",
+    "Bean",
+    "Block",
+    "Fountain",
+    "Pearl",
+    "Pear",
+    "Thimble",
+    "Bunny",
+    "Rope",
+    "String",
+    "Wire",
+    "Lash",
+    "Sorcery",
+    "Sorcerer",
+    "Magician",
+    "Conjurer",
+    "Enchantment",
+    "Enchanter",
+    "Lance",
+    "Lancer",
+    "Freckle",
+    "Pimple",
+    "Wart",
+    "Blotch",
+    "Callus",
+    "Wind",
+    "Haze",
+    "Skin",
+    "Shin",
+    "Torture",
+    "Tool",
+    "Scholar",
+    "Loaf",
+    "Tile",
+    "Sport",
+    "Search",
+    "Worth",
+    "Fright",
+    "Disgust",
+    "Outrage",
+    "Cruelty",
+    "Deviance",
+    "Morality",
+    "Immorality",
+    "Grief",
+    "Belt",
+    "Sandal",
+    "Future",
+    "Past",
+    "Present",
+    "Bite",
+    "Strangulation",
+    "Gallows",
+    "Muscle",
+    "Spurt",
+    "Gravel",
+    "Risk",
+    "Chance",
+    "Channel",
+    "Mirth",
+    "Glee",
+    "Victim",
+    "Stranger",
+    "Vision",
+    "Visionary",
+    "Oracle",
+    "Utterance",
+    "Decision",
+    "Author",
+    "Authority",
+    "Portent",
+    "Ambiguity",
+    "Curiosity",
+    "Obscurity",
+    "Obscenity",
+    "Obstacle",
+    "Vulgarity",
+    "Island",
+    "Church",
+    "Temple",
+    "Cult",
+    "Coven",
+    "Sect",
+    "Order",
+    "Creed",
+    "Communion",
+    "Doctrine",
+    "Faith",
+    "Denomination",
+    "Guilt",
+    "Baby",
+    "Girl",
+    "Boy",
+    "Woman",
+    "Flag",
+    "Banner",
+    "Wreath",
+    "Standard",
+    "Trumpet",
+    "Goal",
+    "Jail",
+    "Prison",
+    "Library",
+    "Avalanche",
+    "Stigma",
+    "Jailer",
+    "Calm",
+    "Lull",
+    "Noiselessness",
+    "Quiescence",
+    "Quietness",
+    "Reticence",
+    "Saturninity",
+    "Speechlessness",
+    "Fortune",
+    "Accident",
+    "Circumstance",
+    "Contingent",
+    "Contingency",
+    "Coincidence",
+    "Fluke",
+    "Luck",
+    "Certainty",
+    "Uncertainty",
+    "Incident",
+    "Amusement",
+    "Pastime",
+    "Distraction",
+    "Diversion",
+    "Recreation",
+    "Competition",
+    "Contest",
+    "Match",
+    "Tournament",
+    "Plan",
+    "Scenario",
+    "Strategy",
+    "Tactic",
+    "Autonomy",
+    "Emancipation",
+    "Extrication",
+    "Impunity",
+    "Liberation",
+    "Liberty",
+    "Release",
+    "Relief",
+    "Evenness",
+    "Balance",
+    "Equity",
+    "Equivalence",
+    "Parity",
+    "Stasis",
+    "Symmetry",
+    "Equality",
+    "Harmony",
+    "Neutralization",
+    "Neutrality",
+    "Stability",
+    "Dourness",
+    "Gloom",
+    "Severity",
+    "Glumness",
+    "Image",
+    "Shrine",
+    "Sanctuary",
+    "Monastery",
+    "Convent",
+    "Cathedral",
+    "Chapel",
+    "Sanctum",
+    "Inferno",
+    "Conflagration",
+    "Flare",
+    "Heat",
+    "Sand",
+    "Pillar",
+    "Column",
+    "Arch",
+    "Grotto",
+    "Cavern",
+    "Depth",
+    "Shade",
+    "Veil",
+    "Relic",
+    "Umbra",
+    "Phantom",
+    "Murk",
+    "Lover",
+    "Escort",
+    "Suitor",
+    "Pungency",
+    "Infection",
+    "Lesion",
+    "Affliction",
+    "Ache",
+    "Epidemic",
+    "Fight",
+    "Scuffle",
+    "Yawn",
+    "Action",
+    "Assault",
+    "Carnality",
+    "Strife",
+    "Combat",
+    "Citadel",
+    "City",
+    "Town",
+    "Village",
+    "Manor",
+    "Mansion",
+    "Palace",
+    "Cottage",
+    "Shack",
+    "Hut",
+    "Hovel",
+    "Bastion",
+    "Furnace",
+    "Anvil",
+    "Bridge",
+    "Safety",
+    "Goad",
+    "Machine",
+    "Flayer",
+    "Oil",
+    "Suicide",
+    "Marble",
+    "Bait",
+    "Lure",
+    "Reward",
+    "Ward",
+    "Price",
+    "Prince",
+    "Princess",
+    "Temptation",
+    "Spurn",
+    "Scorn",
+    "Contempt",
+    "Affection",
+    "Compassion",
+    "Sacrifice",
+    "Charity",
+    "Malice",
+    "Hatred",
+    "Spite",
+    "Shore",
+    "Beach",
+    "Coast",
+    "Insect",
+    "Bug",
+    "Critter",
+    "Brute",
+    "Pet",
+    "Barbarian",
+    "Harshness",
+    "Ferocity",
+    "Barbarity",
+    "Fury",
+    "Ruthlessness",
+    "Gore",
+    "Champion",
+    "Virtue",
+    "Scandal",
+    "Apogee",
+    "Spire",
+    "Spiral",
+    "Climax",
+    "Climate",
+    "Weather",
+    "Crest",
+    "Culmination",
+    "Cusp",
+    "Peak",
+    "Roof",
+    "Ceiling",
+    "Floor",
+    "Summit",
+    "Tip",
+    "Top",
+    "Bottom",
+    "Side",
+    "Zenith",
+    "Pass",
+    "Passage",
+    "Corridor",
+    "Hall",
+    "Gallery",
+    "Galley",
+    "Arena",
+    "Armory",
+    "Assembly",
+    "Meeting",
+    "Theater",
+    "Entrance",
+    "Exit",
+    "Entry",
+    "Vestibule",
+    "Frost",
+    "Fever",
+    "Humidity",
+    "Humor",
+    "Comedy",
+    "Warmth",
+    "Dale",
+    "Dell",
+    "Glade",
+    "Vale",
+    "Basin",
+    "Bowl",
+    "Cavity",
+    "Crater",
+    "Den",
+    "Dent",
+    "Depression",
+    "Dimple",
+    "Dip",
+    "Dish",
+    "Excavation",
+    "Groove",
+    "Gulf",
+    "Distance",
+    "Notch",
+    "Scoop",
+    "Socket",
+    "Trough",
+    "Valley",
+    "Fence",
+    "Barricade",
+    "Blockade",
+    "Board",
+    "Plank",
+    "Defender",
+    "Defense",
+    "Dike",
+    "Palisade",
+    "Post",
+    "Rampart",
+    "Stake",
+    "Stop",
+    "Stockade",
+    "Abyss",
+    "Chasm",
+    "Crevice",
+    "Rift",
+    "Fissure",
+    "Cyclone",
+    "Typhoon",
+    "Hurricane",
+    "Gale",
+    "Tornado",
+    "Hail",
+    "Robustness",
+    "Hardiness",
+    "Vigor",
+    "Air",
+    "Splash",
+    "Dabbler",
+    "Moistness",
+    "Plunge",
+    "Shower",
+    "Slop",
+    "Spray",
+    "Twinkle",
+    "Wad",
+    "Appearance",
+    "Disappearance",
+    "Evaporation",
+    "Luster",
+    "Tone",
+    "Vanishment",
+    "Abatement",
+    "Decline",
+    "Deterioration",
+    "Diminishment",
+    "Dispersal",
+    "Droopiness",
+    "Kindling",
+    "Stoker",
+    "Poker",
+    "Feed",
+    "Failure",
+    "Lesson",
+    "Teacher",
+    "Mastery",
+    "Perishment",
+    "Tiredness",
+    "Wane",
+    "Weakness",
+    "Wilt",
+    "Honor",
+    "Adoration",
+    "Adulation",
+    "Celebration",
+    "Confidence",
+    "Deference",
+    "Deity",
+    "Distinction",
+    "Elevation",
+    "Esteem",
+    "Exaltation",
+    "Fame",
+    "Fealty",
+    "Homage",
+    "Mortal",
+    "Immortal",
+    "Obeisance",
+    "Praise",
+    "Prestige",
+    "Renown",
+    "Reputation",
+    "Tribute",
+    "Worship",
+    "Chastity",
+    "Courage",
+    "Decency",
+    "Good",
+    "Innocence",
+    "Modesty",
+    "Principle",
+    "Purity",
+    "Righteousness",
+    "Truth",
+    "Virgin",
+    "Virginity",
+    "Hold",
+    "Scale",
+    "Clan",
+    "Labyrinth",
+    "Maze",
+    "Web",
+    "Crowd",
+    "Family",
+    "Kin",
+    "Mob",
+    "Organ",
+    "Organization",
+    "Mesh",
+    "Tangle",
+    "Entanglement",
+    "Puzzle",
+    "Quandary",
+    "Combination",
+    "Flicker",
+    "Brand",
+    "Ignition",
+    "Incineration",
+    "Glow",
+    "Cremation",
+    "Faction",
+    "Crew",
+    "Vessel",
+    "League",
+    "Cooperation",
+    "Group",
+    "Gang",
+    "Fellowship",
+    "Partner",
+    "Riddle",
+    "Rout",
+    "Scrape",
+    "Scrap",
+    "Soap",
+    "Sponge",
+    "Whisker",
+    "Winnower",
+    "Clinch",
+    "Clout",
+    "Clutch",
+    "Domination",
+    "Dominion",
+    "Grasp",
+    "Influence",
+    "Owner",
+    "Ownership",
+    "Tenacity",
+    "Catch",
+    "Confinement",
+    "Container",
+    "Cradle",
+    "Embrace",
+    "Pool",
+    "Society",
+    "Circle",
+    "Square",
+    "Triangle",
+    "Connection",
+    "Confusion",
+    "Complexity",
+    "Bewilderment",
+    "Morass",
+    "Problem",
+    "Intricacy",
+    "Mop",
+    "Polish",
+    "Purge",
+    "Rasp",
+    "Band",
+    "Bulb",
+    "Ally",
+    "Alliance",
+    "Allegiance",
+    "Coalition",
+    "Coal",
+    "Enjoyment",
+    "Handle",
+    "Imprisonment",
+    "Nourishment",
+    "Trammel",
+    "Vice",
+    "Vise",
+    "Defect",
+    "Perfection",
+    "Gem",
+    "Jewel",
+    "Conjunction",
+    "Blot",
+    "Brush",
+    "Clarity",
+    "Erasure",
+    "Morsel",
+    "Mongrel",
+    "Tenderness",
+    "Urge",
+    "Mechanism",
+    "Smear",
+    "Tattoo",
+    "Weathering",
+    "Crux",
+    "Peek",
+    "Attic",
+    "Basement",
+    "Dearth",
+    "Apex",
+    "Nadir",
+    "Tunnel",
+    "Delight",
+    "Joy",
+    "Frigidity",
+    "Ankle",
+    "Elbow",
+    "Passion",
+    "Stream",
+    "Bowel",
+    "Drill",
+    "Boredom",
+    "Fleck",
+    "Spot",
+    "Dot",
+    "Creation",
+    "Poem",
+    "Poetry",
+    "Poet",
+    "Scribe",
+    "Monk",
+    "Hermit",
+    "Recluse",
+    "Name",
+    "Language",
+    "Phrase",
+    "Rhyme",
+    "Rhythm",
+    "Verse",
+    "Creature",
+    "Snail",
+    "Vine",
+    "Dweller",
+    "Habit",
+    "Swallow",
+    "Disemboweler",
+    "Eviscerator",
+    "Rapidity",
+    "Medicine",
+    "Healer",
+    "Market",
+    "Mire",
+    "Admirer",
+    "Dirge",
+    "Lamentation",
+    "Funeral",
+    "Quest",
+    "Adventure",
+    "Morning",
+    "Bulwark",
+    "Cosmos",
+    "Anguish",
+    "Deification",
+    "Infamy",
+    "Mortality",
+    "Immortality",
+    "Mortification",
+    "Worshipper",
+    "Dwelling",
+    "Disembowelment",
+    "Evisceration",
+    "Healing",
+    "Admiration",
+    "Conflict",
+    "Attack",
+    "Onslaught",
+    "Tree",
+    "Amber",
+    "Amethyst",
+    "Aquamarine",
+    "Grayness",
+    "Brass",
+    "Charcoal",
+    "Chestnut",
+    "Chocolate",
+    "Cinnamon",
+    "Cobalt",
+    "Olive",
+    "Emerald",
+    "Flax",
+    "Blush",
+    "Lemon",
+    "Lilac",
+    "Lime",
+    "Moss",
+    "Orange",
+    "Periwinkle",
+    "Plum",
+    "Pumpkin",
+    "Saffron",
+    "Turquoise",
+    "Path",
+    "Threat",
+    "Warning",
+    "Fate",
+    "Destiny",
+    "Horror",
+    "Life",
+    "Cheese",
+    "Figure",
+    "Hope",
+    "Body",
+    "Walk",
+    "Hour",
+    "Moment",
+    "Beauty",
+    "Judge",
+    "Wish",
+    "Respect",
+    "Mark",
+    "Heaviness",
+    "Trial",
+    "Practice",
+    "End",
+    "Start",
+    "Beginning",
+    "Birth",
+    "Learning",
+    "Mischief",
+    "Wisdom",
+    "Knower",
+    "Knowledge",
+    "Crack",
+    "Leap",
+    "Jump",
+    "Dive",
+    "Vault",
+    "Treasury",
+    "Betrayal",
+    "Treason",
+    "Reason",
+    "Festival",
+    "Company",
+};
+// clang-format on